@@ -0,0 +1,299 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+// Trace-replay benchmark of the Core0 input pipeline, see bench/README.md.
+//
+// For every input mode and trace: wipe the emulated flash, save a config with that input mode in a
+// child process, then boot GP2040 in another child exactly as main() would (setup(), then start())
+// and step process() through the trace on the virtual clock. Each child prints PerfStats' per-stage
+// numbers plus its own timing of the whole process() call, and the count and CRC32 of the reports
+// that came out, which only change when the pipeline's behaviour does.
+
+#include "hal/benchhal.h"
+
+#include "gp2040.h"
+#include "config_utils.h"
+#include "perfstats.h"
+#include "FlashPROM.h"
+#include "enums.pb.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#define BENCH_DEFAULT_PERIOD_US 1000
+#define BENCH_BOOT_US 1000000
+
+struct BenchMode {
+    const char* name;
+    InputMode inputMode;
+};
+
+static const BenchMode benchModes[] = {
+    { "xinput",       INPUT_MODE_XINPUT },
+    { "switch",       INPUT_MODE_SWITCH },
+    { "ps3",          INPUT_MODE_PS3 },
+    { "keyboard",     INPUT_MODE_KEYBOARD },
+    { "ps4",          INPUT_MODE_PS4 },
+    { "ps5",          INPUT_MODE_PS5 },
+    { "xbone",        INPUT_MODE_XBONE },
+    { "mdmini",       INPUT_MODE_MDMINI },
+    { "neogeo",       INPUT_MODE_NEOGEO },
+    { "pcemini",      INPUT_MODE_PCEMINI },
+    { "egret",        INPUT_MODE_EGRET },
+    { "astro",        INPUT_MODE_ASTRO },
+    { "psclassic",    INPUT_MODE_PSCLASSIC },
+    { "xboxoriginal", INPUT_MODE_XBOXORIGINAL },
+    { "generic",      INPUT_MODE_GENERIC },
+};
+
+// Hold the pressed GPIOs for this many loops
+struct TraceStep {
+    uint32_t loops;
+    uint32_t pressed;
+};
+
+struct Trace {
+    std::string name;
+    std::vector<TraceStep> steps;
+};
+
+static void usage(const char* argv0) {
+    fprintf(stderr,
+        "usage: %s [--mode name[,name...]] [--period-us us] [--repeat n] trace...\n"
+        "\n"
+        "  --mode       input modes to run, default all of them:", argv0);
+    for (const BenchMode& mode : benchModes)
+        fprintf(stderr, " %s", mode.name);
+    fprintf(stderr,
+        "\n"
+        "  --period-us  virtual time between the starts of two loops, default %u\n"
+        "  --repeat     replay each trace this many times in a row, default 1\n",
+        BENCH_DEFAULT_PERIOD_US);
+}
+
+static bool parseTrace(const char* path, Trace& trace) {
+    FILE* file = fopen(path, "r");
+    if (file == nullptr) {
+        fprintf(stderr, "%s: can't open\n", path);
+        return false;
+    }
+
+    trace.name = path;
+    char line[512];
+    uint32_t lineNumber = 0;
+    bool ok = true;
+    while (ok && fgets(line, sizeof(line), file) != nullptr) {
+        lineNumber++;
+        char* comment = strchr(line, '#');
+        if (comment != nullptr)
+            *comment = '\0';
+
+        char* save = nullptr;
+        char* loopsToken = strtok_r(line, " \t\r\n", &save);
+        if (loopsToken == nullptr)
+            continue;
+        char* pinsToken = strtok_r(nullptr, " \t\r\n", &save);
+        char* end = nullptr;
+        unsigned long loops = strtoul(loopsToken, &end, 10);
+        if (*end != '\0' || loops == 0 || pinsToken == nullptr || strtok_r(nullptr, " \t\r\n", &save) != nullptr) {
+            fprintf(stderr, "%s:%u: expected \"<loops> <gpio,gpio,...|->\"\n", path, lineNumber);
+            ok = false;
+            break;
+        }
+
+        TraceStep step = { (uint32_t)loops, 0 };
+        if (strcmp(pinsToken, "-") != 0) {
+            char* pinSave = nullptr;
+            for (char* pin = strtok_r(pinsToken, ",", &pinSave); pin != nullptr; pin = strtok_r(nullptr, ",", &pinSave)) {
+                unsigned long gpio = strtoul(pin, &end, 10);
+                if (*end != '\0' || gpio >= NUM_BANK0_GPIOS) {
+                    fprintf(stderr, "%s:%u: \"%s\" is not a GPIO\n", path, lineNumber, pin);
+                    ok = false;
+                    break;
+                }
+                step.pressed |= 1u << gpio;
+            }
+        }
+        trace.steps.push_back(step);
+    }
+    fclose(file);
+
+    if (ok && trace.steps.empty()) {
+        fprintf(stderr, "%s: no steps\n", path);
+        ok = false;
+    }
+    return ok;
+}
+
+// Runs fn in a child so every run starts from a freshly booted firmware. Returns the exit status.
+template <typename F> static int runInChild(F fn) {
+    fflush(stdout);
+    fflush(stderr);
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        return -1;
+    }
+    if (pid == 0) {
+        int status = fn();
+        fflush(stdout);
+        _exit(status);
+    }
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    if (WIFSIGNALED(status)) {
+        fprintf(stderr, "killed by signal %d\n", WTERMSIG(status));
+        return -1;
+    }
+    return WEXITSTATUS(status);
+}
+
+// What the first boot after flashing would save, with the input mode set. Frame sync is off as there's
+// no SOF interrupt to wait for.
+static int seedConfig(InputMode inputMode) {
+    static Config config;
+    EEPROM.start();
+    ConfigUtils::load(config);
+    config.gamepadOptions.inputMode = inputMode;
+    config.gamepadOptions.frameSyncedReports = false;
+    if (!ConfigUtils::save(config))
+        return 1;
+    EEPROM.flush();
+    return 0;
+}
+
+static void printRow(const char* name, uint32_t count, uint32_t min, uint32_t avg, uint32_t p99, uint32_t max) {
+    printf("  %-22s %9u %9u %9u %9u %9u\n", name, count, min, avg, p99, max);
+}
+
+static int replayTrace(const Trace& trace, uint32_t periodUs, uint32_t repeat) {
+    benchSetTimeUs(BENCH_BOOT_US);
+    benchSetPressed(0);
+
+    GP2040* gp2040 = new GP2040();
+    gp2040->setup();
+    gp2040->start();
+
+    std::vector<uint32_t> loopTicks;
+    uint64_t loopTotal = 0;
+    for (uint32_t r = 0; r < repeat; r++) {
+        for (const TraceStep& step : trace.steps) {
+            benchSetPressed(step.pressed);
+            for (uint32_t i = 0; i < step.loops; i++) {
+                benchSetTimeUs(benchGetTimeUs() + periodUs);
+                uint64_t start = bench_host_cycles();
+                gp2040->process();
+                uint32_t ticks = (uint32_t)(bench_host_cycles() - start);
+                loopTicks.push_back(ticks);
+                loopTotal += ticks;
+            }
+        }
+    }
+    std::sort(loopTicks.begin(), loopTicks.end());
+
+    printf("  %-22s %9s %9s %9s %9s %9s\n", "stage (host ticks)", "count", "min", "avg", "p99", "max");
+    printRow("process()", loopTicks.size(), loopTicks.front(), loopTotal / loopTicks.size(),
+             loopTicks[(loopTicks.size() * 99) / 100], loopTicks.back());
+
+    // The stages PerfStats times in microseconds only see the virtual clock, which doesn't move inside a loop
+    PerfStats& perfStats = PerfStats::getInstance();
+    for (uint32_t stage = 0; stage < perfStats.getStageCount(); stage++) {
+        if (stage == PERF_STAGE_CORE0_LOOP || stage == PERF_STAGE_FLASH_COMMIT || stage == PERF_STAGE_REPORT_AGE)
+            continue;
+        PerfStageSummary summary;
+        if (!perfStats.getStage(stage, summary) || summary.count == 0)
+            continue;
+
+        static const char* const phaseNames[] = { "", "/pre", "/process", "/post" };
+        std::string name = std::string(summary.name) + phaseNames[summary.phase & 3];
+        printRow(name.c_str(), summary.count, summary.min, summary.avg, summary.p99, summary.max);
+    }
+
+    printf("  reports %u, crc32 %08x\n", benchReportCount(), benchReportCrc());
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<const BenchMode*> modes;
+    std::vector<Trace> traces;
+    uint32_t periodUs = BENCH_DEFAULT_PERIOD_US;
+    uint32_t repeat = 1;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (strcmp(arg, "--mode") == 0 && i + 1 < argc) {
+            std::string list = argv[++i];
+            size_t start = 0;
+            while (start <= list.size()) {
+                size_t comma = list.find(',', start);
+                std::string name = list.substr(start, comma == std::string::npos ? std::string::npos : comma - start);
+                const BenchMode* found = nullptr;
+                for (const BenchMode& mode : benchModes) {
+                    if (name == mode.name)
+                        found = &mode;
+                }
+                if (found == nullptr) {
+                    fprintf(stderr, "unknown mode \"%s\"\n", name.c_str());
+                    usage(argv[0]);
+                    return 1;
+                }
+                modes.push_back(found);
+                if (comma == std::string::npos)
+                    break;
+                start = comma + 1;
+            }
+        } else if (strcmp(arg, "--period-us") == 0 && i + 1 < argc) {
+            periodUs = strtoul(argv[++i], nullptr, 10);
+        } else if (strcmp(arg, "--repeat") == 0 && i + 1 < argc) {
+            repeat = strtoul(argv[++i], nullptr, 10);
+        } else if (arg[0] == '-') {
+            usage(argv[0]);
+            return 1;
+        } else {
+            traces.emplace_back();
+            if (!parseTrace(arg, traces.back()))
+                return 1;
+        }
+    }
+
+    if (traces.empty() || periodUs == 0 || repeat == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+    if (modes.empty()) {
+        for (const BenchMode& mode : benchModes)
+            modes.push_back(&mode);
+    }
+
+    if (!benchFlashMap()) {
+        fprintf(stderr, "can't map the emulated flash at 0x%08x\n", XIP_BASE);
+        return 1;
+    }
+
+    int failures = 0;
+    for (const BenchMode* mode : modes) {
+        for (const Trace& trace : traces) {
+            printf("%s %s\n", mode->name, trace.name.c_str());
+
+            benchFlashErase();
+            int status = runInChild([&]() { return seedConfig(mode->inputMode); });
+            if (status == 0)
+                status = runInChild([&]() { return replayTrace(trace, periodUs, repeat); });
+            if (status != 0) {
+                printf("  failed (%d)\n", status);
+                failures++;
+            }
+        }
+    }
+
+    return failures ? 1 : 0;
+}
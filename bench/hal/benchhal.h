@@ -0,0 +1,29 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+#ifndef _BENCH_HAL_H_
+#define _BENCH_HAL_H_
+
+// The bench's side of the stubbed SDK: what bench.cpp drives (time, pins, flash) and what it reads
+// back (reports). The firmware only ever sees the pico-sdk/TinyUSB surface in bench/hal/include.
+
+#include <stdint.h>
+
+// Maps the 2 MB of emulated flash at XIP_BASE, shared with forked children. Returns false if the
+// address range is taken.
+bool benchFlashMap();
+void benchFlashErase();  // back to all 0xFF, as a freshly flashed board
+
+void benchSetTimeUs(uint64_t us);
+uint64_t benchGetTimeUs();
+
+// GPIOs in the mask read as pressed (low), every other input reads high through its pull-up
+void benchSetPressed(uint32_t mask);
+
+// Every IN report handed to TinyUSB, on any endpoint
+uint32_t benchReportCount();
+uint32_t benchReportCrc();
+
+#endif
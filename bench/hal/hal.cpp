@@ -0,0 +1,599 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+// Host definitions for the stubbed pico-sdk in bench/hal/include.
+//
+// Time is virtual: it only moves when the bench sets it, when something busy-waits or sleeps, or by
+// 1 us per turn of a tight_loop_contents() spin. The SysTick counter PerfStats reads is the host's
+// cycle counter, and clk_sys reports 1 GHz so its nanoseconds are host cycles. Flash is 2 MB of
+// shared anonymous memory mapped at XIP_BASE, so the config code reads it by address exactly as
+// it does on the device.
+
+#include "benchhal.h"
+
+#include "pico.h"
+#include "hardware/adc.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/flash.h"
+#include "hardware/gpio.h"
+#include "hardware/i2c.h"
+#include "hardware/irq.h"
+#include "hardware/pio.h"
+#include "hardware/spi.h"
+#include "hardware/timer.h"
+#include "hardware/watchdog.h"
+#include "hardware/structs/ioqspi.h"
+#include "hardware/structs/sio.h"
+#include "hardware/structs/systick.h"
+#include "hardware/structs/usb.h"
+
+#include <stdarg.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <chrono>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE 0x100000
+#endif
+
+static uint64_t timeUs = 0;
+static uint32_t pressedMask = 0;
+
+systick_hw_t systick_hw_host = {};
+usb_hw_t usb_hw_host = {};
+timer_hw_t timer_hw_host = {};
+adc_hw_t adc_hw_host = {};
+dma_hw_t dma_hw_host = {};
+sio_hw_t sio_hw_host = {};
+ioqspi_hw_t ioqspi_hw_host = {};
+watchdog_hw_t watchdog_hw_host = {};
+pio_hw_t pio0_hw_host = {};
+pio_hw_t pio1_hw_host = {};
+i2c_inst_t i2c0_inst = {};
+i2c_inst_t i2c1_inst = {};
+spi_inst_t spi0_inst = {};
+spi_inst_t spi1_inst = {};
+
+// The read-only registers are plain memory here, the bench is the hardware that writes them
+template <typename T> static void setRegister(const volatile T& reg, T value) {
+    const_cast<volatile T&>(reg) = value;
+}
+
+static void updateClockRegisters() {
+    setRegister(usb_hw_host.sof_rd, (uint32_t)((timeUs / 1000) & USB_SOF_RD_BITS));
+    setRegister(timer_hw_host.timerawl, (uint32_t)timeUs);
+    setRegister(timer_hw_host.timerawh, (uint32_t)(timeUs >> 32));
+    setRegister(timer_hw_host.timelr, (uint32_t)timeUs);
+    setRegister(timer_hw_host.timehr, (uint32_t)(timeUs >> 32));
+}
+
+static void updateGpioRegisters() {
+    setRegister(sio_hw_host.gpio_in, ~pressedMask & ((1u << NUM_BANK0_GPIOS) - 1));
+    setRegister(sio_hw_host.gpio_hi_in, (uint32_t)0x3f);
+}
+
+//--------------------------------------------------------------------+
+// Bench side
+//--------------------------------------------------------------------+
+bool benchFlashMap() {
+    void *flash = mmap((void *)XIP_BASE, PICO_FLASH_SIZE_BYTES, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if (flash == MAP_FAILED)
+        return false;
+    if (flash != (void *)XIP_BASE) {
+        // kernels older than 4.17 take MAP_FIXED_NOREPLACE as a hint
+        munmap(flash, PICO_FLASH_SIZE_BYTES);
+        return false;
+    }
+    benchFlashErase();
+    updateGpioRegisters();
+    return true;
+}
+
+void benchFlashErase() {
+    memset((void *)XIP_BASE, 0xff, PICO_FLASH_SIZE_BYTES);
+}
+
+void benchSetTimeUs(uint64_t us) {
+    timeUs = us;
+    updateClockRegisters();
+}
+
+uint64_t benchGetTimeUs() {
+    return timeUs;
+}
+
+void benchSetPressed(uint32_t mask) {
+    pressedMask = mask;
+    updateGpioRegisters();
+}
+
+uint64_t bench_host_cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+//--------------------------------------------------------------------+
+// pico.h
+//--------------------------------------------------------------------+
+uint get_core_num(void) { return 0; }
+
+void panic(const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    fprintf(stderr, "panic: ");
+    vfprintf(stderr, fmt, args);
+    fprintf(stderr, "\n");
+    va_end(args);
+    _exit(2);
+}
+
+void tight_loop_contents(void) { benchSetTimeUs(timeUs + 1); }
+
+uint64_t time_us_64(void) { return timeUs; }
+uint32_t time_us_32(void) { return (uint32_t)timeUs; }
+
+void busy_wait_us(uint64_t delay_us) { benchSetTimeUs(timeUs + delay_us); }
+void busy_wait_us_32(uint32_t delay_us) { benchSetTimeUs(timeUs + delay_us); }
+void busy_wait_ms(uint32_t delay_ms) { benchSetTimeUs(timeUs + (uint64_t)delay_ms * 1000); }
+void busy_wait_until(absolute_time_t t) { if (t > timeUs) benchSetTimeUs(t); }
+void sleep_us(uint64_t us) { busy_wait_us(us); }
+void sleep_ms(uint32_t ms) { busy_wait_ms(ms); }
+void sleep_until(absolute_time_t t) { busy_wait_until(t); }
+
+// Everything runs on the one thread, so there's never anyone to lock out
+static spin_lock_t spinLocks[NUM_SPIN_LOCKS];
+static uint32_t spinLocksClaimed = 0;
+
+uint32_t save_and_disable_interrupts(void) { return 0; }
+void restore_interrupts(uint32_t status) { (void)status; }
+spin_lock_t *spin_lock_instance(uint lock_num) { return &spinLocks[lock_num % NUM_SPIN_LOCKS]; }
+void spin_lock_claim(uint lock_num) { spinLocksClaimed |= 1u << lock_num; }
+void spin_lock_unclaim(uint lock_num) { spinLocksClaimed &= ~(1u << lock_num); }
+spin_lock_t *spin_lock_init(uint lock_num) { return spin_lock_instance(lock_num); }
+uint32_t spin_lock_blocking(spin_lock_t *lock) { (void)lock; return 0; }
+void spin_unlock(spin_lock_t *lock, uint32_t saved_irq) { (void)lock; (void)saved_irq; }
+
+int spin_lock_claim_unused(bool required) {
+    for (uint lock = 16; lock < NUM_SPIN_LOCKS; lock++) {
+        if (!(spinLocksClaimed & (1u << lock))) {
+            spin_lock_claim(lock);
+            return lock;
+        }
+    }
+    if (required)
+        panic("No spin locks are available");
+    return -1;
+}
+
+void critical_section_init(critical_section_t *crit_sec) {
+    critical_section_init_with_lock_num(crit_sec, spin_lock_claim_unused(true));
+}
+
+void critical_section_init_with_lock_num(critical_section_t *crit_sec, uint lock_num) {
+    crit_sec->spin_lock = spin_lock_instance(lock_num);
+    crit_sec->save = 0;
+}
+
+void critical_section_enter_blocking(critical_section_t *crit_sec) { (void)crit_sec; }
+void critical_section_exit(critical_section_t *crit_sec) { (void)crit_sec; }
+void critical_section_deinit(critical_section_t *crit_sec) { crit_sec->spin_lock = nullptr; }
+
+void mutex_init(mutex_t *mtx) { mtx->core.spin_lock = spin_lock_instance(0); mtx->owner = -1; }
+void mutex_enter_blocking(mutex_t *mtx) { mtx->owner = 0; }
+bool mutex_try_enter(mutex_t *mtx, uint32_t *owner_out) {
+    if (mtx->owner >= 0) {
+        if (owner_out)
+            *owner_out = (uint32_t)mtx->owner;
+        return false;
+    }
+    mtx->owner = 0;
+    return true;
+}
+void mutex_exit(mutex_t *mtx) { mtx->owner = -1; }
+
+// Core1 is never launched, the bench only runs the Core0 pipeline
+void multicore_launch_core1(void (*entry)(void)) { (void)entry; }
+void multicore_reset_core1(void) {}
+void multicore_lockout_victim_init(void) {}
+bool multicore_lockout_victim_is_initialized(uint core_num) { (void)core_num; return false; }
+void multicore_lockout_start_blocking(void) {}
+bool multicore_lockout_start_timeout_us(uint64_t timeout_us) { (void)timeout_us; return true; }
+void multicore_lockout_end_blocking(void) {}
+bool multicore_lockout_end_timeout_us(uint64_t timeout_us) { (void)timeout_us; return true; }
+void multicore_fifo_push_blocking(uint32_t data) { (void)data; }
+uint32_t multicore_fifo_pop_blocking(void) { return 0; }
+bool multicore_fifo_rvalid(void) { return false; }
+bool multicore_fifo_wready(void) { return true; }
+void multicore_fifo_drain(void) {}
+
+bool stdio_init_all(void) { return true; }
+
+void reset_usb_boot(uint32_t usb_activity_gpio_pin_mask, uint32_t disable_interface_mask) {
+    (void)usb_activity_gpio_pin_mask;
+    (void)disable_interface_mask;
+    fprintf(stderr, "firmware rebooted into BOOTSEL\n");
+    _exit(3);
+}
+
+// Fixed seed, so runs repeat exactly
+static uint64_t randState = 0x2040ce2040ce2040ull;
+
+uint64_t get_rand_64(void) {
+    randState ^= randState << 13;
+    randState ^= randState >> 7;
+    randState ^= randState << 17;
+    return randState;
+}
+
+uint32_t get_rand_32(void) { return (uint32_t)get_rand_64(); }
+
+void pico_get_unique_board_id(pico_unique_board_id_t *id_out) {
+    for (uint i = 0; i < PICO_UNIQUE_BOARD_ID_SIZE_BYTES; i++)
+        id_out->id[i] = 0xe6 + i;
+}
+
+void pico_get_unique_board_id_string(char *id_out, uint len) {
+    pico_unique_board_id_t id;
+    pico_get_unique_board_id(&id);
+    uint i = 0;
+    for (; i < PICO_UNIQUE_BOARD_ID_SIZE_BYTES && (i * 2 + 2) < len; i++)
+        snprintf(id_out + i * 2, 3, "%02X", id.id[i]);
+    if (len)
+        id_out[MIN(i * 2, len - 1)] = '\0';
+}
+
+//--------------------------------------------------------------------+
+// hardware/clocks.h
+//--------------------------------------------------------------------+
+uint32_t clock_get_hz(enum clock_index clk_index) {
+    switch (clk_index) {
+        case clk_sys: return 1000000000;
+        case clk_usb:
+        case clk_adc: return 48 * MHZ;
+        case clk_ref: return 12 * MHZ;
+        default: return 125 * MHZ;
+    }
+}
+
+bool set_sys_clock_khz(uint32_t freq_khz, bool required) { (void)freq_khz; (void)required; return true; }
+void set_sys_clock_48mhz(void) {}
+
+//--------------------------------------------------------------------+
+// hardware/flash.h
+//--------------------------------------------------------------------+
+void flash_range_erase(uint32_t flash_offs, size_t count) {
+    if (flash_offs + count > PICO_FLASH_SIZE_BYTES)
+        panic("flash_range_erase out of range: %u + %u", flash_offs, (uint)count);
+    memset((uint8_t *)XIP_BASE + flash_offs, 0xff, count);
+}
+
+// NOR flash only ever programs bits from 1 to 0
+void flash_range_program(uint32_t flash_offs, const uint8_t *data, size_t count) {
+    if (flash_offs + count > PICO_FLASH_SIZE_BYTES)
+        panic("flash_range_program out of range: %u + %u", flash_offs, (uint)count);
+    uint8_t *flash = (uint8_t *)XIP_BASE + flash_offs;
+    for (size_t i = 0; i < count; i++)
+        flash[i] &= data[i];
+}
+
+void flash_get_unique_id(uint8_t *id_out) {
+    pico_unique_board_id_t id;
+    pico_get_unique_board_id(&id);
+    memcpy(id_out, id.id, FLASH_UNIQUE_ID_SIZE_BYTES);
+}
+
+// Only JEDEC ID (0x9f) is answered: a Winbond part with 2^21 bytes
+void flash_do_cmd(const uint8_t *txbuf, uint8_t *rxbuf, size_t count) {
+    memset(rxbuf, 0, count);
+    if (count >= 4 && txbuf[0] == 0x9f) {
+        rxbuf[1] = 0xef;
+        rxbuf[2] = 0x40;
+        rxbuf[3] = 21;
+    }
+}
+
+//--------------------------------------------------------------------+
+// hardware/gpio.h
+//--------------------------------------------------------------------+
+void gpio_init(uint gpio) { (void)gpio; }
+void gpio_deinit(uint gpio) { (void)gpio; }
+void gpio_init_mask(uint gpio_mask) { (void)gpio_mask; }
+void gpio_set_dir(uint gpio, bool out) { (void)gpio; (void)out; }
+void gpio_set_dir_in_masked(uint32_t mask) { (void)mask; }
+void gpio_set_dir_out_masked(uint32_t mask) { (void)mask; }
+void gpio_set_function(uint gpio, gpio_function_t fn) { (void)gpio; (void)fn; }
+void gpio_set_pulls(uint gpio, bool up, bool down) { (void)gpio; (void)up; (void)down; }
+void gpio_pull_up(uint gpio) { (void)gpio; }
+void gpio_pull_down(uint gpio) { (void)gpio; }
+void gpio_disable_pulls(uint gpio) { (void)gpio; }
+void gpio_set_inover(uint gpio, uint value) { (void)gpio; (void)value; }
+void gpio_set_outover(uint gpio, uint value) { (void)gpio; (void)value; }
+void gpio_set_oeover(uint gpio, uint value) { (void)gpio; (void)value; }
+void gpio_set_input_enabled(uint gpio, bool enabled) { (void)gpio; (void)enabled; }
+
+bool gpio_get(uint gpio) { return (sio_hw_host.gpio_in >> gpio) & 1; }
+uint32_t gpio_get_all(void) { return sio_hw_host.gpio_in; }
+void gpio_put(uint gpio, bool value) { (void)gpio; (void)value; }
+void gpio_put_all(uint32_t value) { (void)value; }
+void gpio_put_masked(uint32_t mask, uint32_t value) { (void)mask; (void)value; }
+void gpio_set_mask(uint32_t mask) { (void)mask; }
+void gpio_clr_mask(uint32_t mask) { (void)mask; }
+
+void gpio_set_irq_enabled(uint gpio, uint32_t event_mask, bool enabled) { (void)gpio; (void)event_mask; (void)enabled; }
+void gpio_set_irq_enabled_with_callback(uint gpio, uint32_t event_mask, bool enabled, gpio_irq_callback_t callback) {
+    (void)gpio; (void)event_mask; (void)enabled; (void)callback;
+}
+void gpio_set_irq_callback(gpio_irq_callback_t callback) { (void)callback; }
+uint32_t gpio_get_irq_event_mask(uint gpio) { (void)gpio; return 0; }
+void gpio_acknowledge_irq(uint gpio, uint32_t event_mask) { (void)gpio; (void)event_mask; }
+void gpio_add_raw_irq_handler(uint gpio, irq_handler_t handler) { (void)gpio; (void)handler; }
+void gpio_add_raw_irq_handler_masked(uint32_t gpio_mask, irq_handler_t handler) { (void)gpio_mask; (void)handler; }
+void gpio_remove_raw_irq_handler(uint gpio, irq_handler_t handler) { (void)gpio; (void)handler; }
+void gpio_remove_raw_irq_handler_masked(uint32_t gpio_mask, irq_handler_t handler) { (void)gpio_mask; (void)handler; }
+
+//--------------------------------------------------------------------+
+// hardware/irq.h
+//--------------------------------------------------------------------+
+static uint32_t irqEnabled = 0;
+
+void irq_set_enabled(uint num, bool enabled) {
+    if (enabled)
+        irqEnabled |= 1u << num;
+    else
+        irqEnabled &= ~(1u << num);
+}
+bool irq_is_enabled(uint num) { return (irqEnabled >> num) & 1; }
+void irq_set_priority(uint num, uint8_t hardware_priority) { (void)num; (void)hardware_priority; }
+void irq_set_exclusive_handler(uint num, irq_handler_t handler) { (void)num; (void)handler; }
+void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t order_priority) { (void)num; (void)handler; (void)order_priority; }
+void irq_remove_handler(uint num, irq_handler_t handler) { (void)num; (void)handler; }
+
+//--------------------------------------------------------------------+
+// hardware/adc.h, every channel reads mid-scale
+//--------------------------------------------------------------------+
+static uint adcInput = 0;
+
+void adc_init(void) {}
+void adc_gpio_init(uint gpio) { (void)gpio; }
+void adc_select_input(uint input) { adcInput = input; }
+uint adc_get_selected_input(void) { return adcInput; }
+void adc_set_round_robin(uint input_mask) { (void)input_mask; }
+void adc_set_temp_sensor_enabled(bool enable) { (void)enable; }
+uint16_t adc_read(void) { return 0x800; }
+void adc_run(bool run) { (void)run; }
+void adc_set_clkdiv(float clkdiv) { (void)clkdiv; }
+void adc_fifo_setup(bool en, bool dreq_en, uint16_t dreq_thresh, bool err_in_fifo, bool byte_shift) {
+    (void)en; (void)dreq_en; (void)dreq_thresh; (void)err_in_fifo; (void)byte_shift;
+}
+bool adc_fifo_is_empty(void) { return true; }
+uint8_t adc_fifo_get_level(void) { return 0; }
+uint16_t adc_fifo_get(void) { return 0x800; }
+void adc_fifo_drain(void) {}
+void adc_irq_set_enabled(bool enabled) { (void)enabled; }
+
+//--------------------------------------------------------------------+
+// hardware/dma.h, channels can be claimed and set up but never move anything
+//--------------------------------------------------------------------+
+static uint32_t dmaClaimed = 0;
+
+int dma_claim_unused_channel(bool required) {
+    for (uint channel = 0; channel < NUM_DMA_CHANNELS; channel++) {
+        if (!(dmaClaimed & (1u << channel))) {
+            dma_channel_claim(channel);
+            return channel;
+        }
+    }
+    if (required)
+        panic("No DMA channels are available");
+    return -1;
+}
+
+void dma_channel_claim(uint channel) { dmaClaimed |= 1u << channel; }
+void dma_channel_unclaim(uint channel) { dmaClaimed &= ~(1u << channel); }
+dma_channel_config dma_channel_get_default_config(uint channel) { (void)channel; dma_channel_config c = {0}; return c; }
+
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, uint transfer_count, bool trigger) {
+    (void)config; (void)trigger;
+    dma_hw_host.ch[channel].write_addr = (uint32_t)(uintptr_t)write_addr;
+    dma_hw_host.ch[channel].read_addr = (uint32_t)(uintptr_t)read_addr;
+    dma_hw_host.ch[channel].transfer_count = transfer_count;
+}
+
+void dma_channel_set_read_addr(uint channel, const volatile void *read_addr, bool trigger) {
+    (void)trigger;
+    dma_hw_host.ch[channel].read_addr = (uint32_t)(uintptr_t)read_addr;
+}
+
+void dma_channel_set_write_addr(uint channel, volatile void *write_addr, bool trigger) {
+    (void)trigger;
+    dma_hw_host.ch[channel].write_addr = (uint32_t)(uintptr_t)write_addr;
+}
+
+void dma_channel_set_trans_count(uint channel, uint32_t trans_count, bool trigger) {
+    (void)trigger;
+    dma_hw_host.ch[channel].transfer_count = trans_count;
+}
+
+void dma_channel_start(uint channel) { (void)channel; }
+void dma_start_channel_mask(uint32_t chan_mask) { (void)chan_mask; }
+void dma_channel_abort(uint channel) { (void)channel; }
+bool dma_channel_is_busy(uint channel) { (void)channel; return false; }
+void dma_channel_wait_for_finish_blocking(uint channel) { (void)channel; }
+void dma_channel_set_irq0_enabled(uint channel, bool enabled) { (void)channel; (void)enabled; }
+void dma_channel_acknowledge_irq0(uint channel) { dma_hw_host.ints0 &= ~(1u << channel); }
+bool dma_channel_get_irq0_status(uint channel) { return (dma_hw_host.ints0 >> channel) & 1; }
+
+static uint32_t dmaTimersClaimed = 0;
+
+int dma_claim_unused_timer(bool required) {
+    for (uint timer = 0; timer < NUM_DMA_TIMERS; timer++) {
+        if (!(dmaTimersClaimed & (1u << timer))) {
+            dma_timer_claim(timer);
+            return timer;
+        }
+    }
+    if (required)
+        panic("No DMA timers are available");
+    return -1;
+}
+
+void dma_timer_claim(uint timer) { dmaTimersClaimed |= 1u << timer; }
+void dma_timer_unclaim(uint timer) { dmaTimersClaimed &= ~(1u << timer); }
+void dma_timer_set_fraction(uint timer, uint16_t numerator, uint16_t denominator) { (void)timer; (void)numerator; (void)denominator; }
+
+//--------------------------------------------------------------------+
+// hardware/i2c.h, nothing ever answers
+//--------------------------------------------------------------------+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate) { (void)i2c; return baudrate; }
+void i2c_deinit(i2c_inst_t *i2c) { (void)i2c; }
+uint i2c_set_baudrate(i2c_inst_t *i2c, uint baudrate) { (void)i2c; return baudrate; }
+
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop) {
+    (void)i2c; (void)addr; (void)src; (void)len; (void)nostop;
+    return PICO_ERROR_GENERIC;
+}
+
+int i2c_read_blocking(i2c_inst_t *i2c, uint8_t addr, uint8_t *dst, size_t len, bool nostop) {
+    (void)i2c; (void)addr; (void)dst; (void)len; (void)nostop;
+    return PICO_ERROR_GENERIC;
+}
+
+int i2c_write_blocking_until(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop, absolute_time_t until) {
+    (void)until;
+    return i2c_write_blocking(i2c, addr, src, len, nostop);
+}
+
+int i2c_read_blocking_until(i2c_inst_t *i2c, uint8_t addr, uint8_t *dst, size_t len, bool nostop, absolute_time_t until) {
+    (void)until;
+    return i2c_read_blocking(i2c, addr, dst, len, nostop);
+}
+
+int i2c_write_timeout_us(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop, uint timeout_us) {
+    (void)timeout_us;
+    return i2c_write_blocking(i2c, addr, src, len, nostop);
+}
+
+int i2c_read_timeout_us(i2c_inst_t *i2c, uint8_t addr, uint8_t *dst, size_t len, bool nostop, uint timeout_us) {
+    (void)timeout_us;
+    return i2c_read_blocking(i2c, addr, dst, len, nostop);
+}
+
+//--------------------------------------------------------------------+
+// hardware/spi.h, MISO reads zeros
+//--------------------------------------------------------------------+
+uint spi_init(spi_inst_t *spi, uint baudrate) { (void)spi; return baudrate; }
+void spi_deinit(spi_inst_t *spi) { (void)spi; }
+uint spi_set_baudrate(spi_inst_t *spi, uint baudrate) { (void)spi; return baudrate; }
+void spi_set_format(spi_inst_t *spi, uint data_bits, spi_cpol_t cpol, spi_cpha_t cpha, spi_order_t order) {
+    (void)spi; (void)data_bits; (void)cpol; (void)cpha; (void)order;
+}
+
+int spi_write_read_blocking(spi_inst_t *spi, const uint8_t *src, uint8_t *dst, size_t len) {
+    (void)spi; (void)src;
+    memset(dst, 0, len);
+    return (int)len;
+}
+
+int spi_write_blocking(spi_inst_t *spi, const uint8_t *src, size_t len) { (void)spi; (void)src; return (int)len; }
+
+int spi_read_blocking(spi_inst_t *spi, uint8_t repeated_tx_data, uint8_t *dst, size_t len) {
+    (void)spi; (void)repeated_tx_data;
+    memset(dst, 0, len);
+    return (int)len;
+}
+
+int spi_write16_read16_blocking(spi_inst_t *spi, const uint16_t *src, uint16_t *dst, size_t len) {
+    (void)spi; (void)src;
+    memset(dst, 0, len * sizeof(uint16_t));
+    return (int)len;
+}
+
+int spi_write16_blocking(spi_inst_t *spi, const uint16_t *src, size_t len) { (void)spi; (void)src; return (int)len; }
+
+int spi_read16_blocking(spi_inst_t *spi, uint16_t repeated_tx_data, uint16_t *dst, size_t len) {
+    (void)spi; (void)repeated_tx_data;
+    memset(dst, 0, len * sizeof(uint16_t));
+    return (int)len;
+}
+
+//--------------------------------------------------------------------+
+// hardware/pio.h
+//--------------------------------------------------------------------+
+static uint32_t pioClaimed[NUM_PIOS] = {0, 0};
+static uint8_t pioUsed[NUM_PIOS] = {0, 0};
+
+int pio_claim_unused_sm(PIO pio, bool required) {
+    for (uint sm = 0; sm < NUM_PIO_STATE_MACHINES; sm++) {
+        if (!(pioClaimed[pio_get_index(pio)] & (1u << sm))) {
+            pio_sm_claim(pio, sm);
+            return sm;
+        }
+    }
+    if (required)
+        panic("No PIO state machines are available");
+    return -1;
+}
+
+void pio_sm_claim(PIO pio, uint sm) { pioClaimed[pio_get_index(pio)] |= 1u << sm; }
+void pio_sm_unclaim(PIO pio, uint sm) { pioClaimed[pio_get_index(pio)] &= ~(1u << sm); }
+
+bool pio_can_add_program(PIO pio, const pio_program_t *program) {
+    return pioUsed[pio_get_index(pio)] + program->length <= 32;
+}
+
+uint pio_add_program(PIO pio, const pio_program_t *program) {
+    if (!pio_can_add_program(pio, program))
+        panic("No program space");
+    uint offset = pioUsed[pio_get_index(pio)];
+    pioUsed[pio_get_index(pio)] += program->length;
+    return offset;
+}
+
+void pio_remove_program(PIO pio, const pio_program_t *program, uint loaded_offset) { (void)pio; (void)program; (void)loaded_offset; }
+void pio_gpio_init(PIO pio, uint pin) { (void)pio; (void)pin; }
+int pio_sm_init(PIO pio, uint sm, uint initial_pc, const pio_sm_config *config) { (void)pio; (void)sm; (void)initial_pc; (void)config; return PICO_OK; }
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled) { (void)pio; (void)sm; (void)enabled; }
+void pio_sm_set_consecutive_pindirs(PIO pio, uint sm, uint pin_base, uint pin_count, bool is_out) {
+    (void)pio; (void)sm; (void)pin_base; (void)pin_count; (void)is_out;
+}
+void pio_sm_set_pins_with_mask(PIO pio, uint sm, uint32_t pin_values, uint32_t pin_mask) { (void)pio; (void)sm; (void)pin_values; (void)pin_mask; }
+void pio_sm_set_pindirs_with_mask(PIO pio, uint sm, uint32_t pin_dirs, uint32_t pin_mask) { (void)pio; (void)sm; (void)pin_dirs; (void)pin_mask; }
+void pio_sm_exec(PIO pio, uint sm, uint instr) { (void)pio; (void)sm; (void)instr; }
+void pio_sm_put(PIO pio, uint sm, uint32_t data) { (void)pio; (void)sm; (void)data; }
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data) { (void)pio; (void)sm; (void)data; }
+uint32_t pio_sm_get(PIO pio, uint sm) { (void)pio; (void)sm; return 0; }
+uint32_t pio_sm_get_blocking(PIO pio, uint sm) { (void)pio; (void)sm; return 0; }
+uint pio_sm_get_rx_fifo_level(PIO pio, uint sm) { (void)pio; (void)sm; return 0; }
+bool pio_sm_is_rx_fifo_empty(PIO pio, uint sm) { (void)pio; (void)sm; return true; }
+bool pio_sm_is_tx_fifo_full(PIO pio, uint sm) { (void)pio; (void)sm; return false; }
+void pio_sm_clear_fifos(PIO pio, uint sm) { (void)pio; (void)sm; }
+void pio_sm_restart(PIO pio, uint sm) { (void)pio; (void)sm; }
+
+//--------------------------------------------------------------------+
+// hardware/watchdog.h
+//--------------------------------------------------------------------+
+// A reboot ends the run, the bench reports it as a failure for that mode
+void watchdog_reboot(uint32_t pc, uint32_t sp, uint32_t delay_ms) {
+    (void)pc; (void)sp; (void)delay_ms;
+    fprintf(stderr, "firmware rebooted (boot mode %u)\n", watchdog_hw_host.scratch[5]);
+    _exit(3);
+}
+
+bool watchdog_caused_reboot(void) { return false; }
+bool watchdog_enable_caused_reboot(void) { return false; }
+void watchdog_enable(uint32_t delay_ms, bool pause_on_debug) { (void)delay_ms; (void)pause_on_debug; }
+void watchdog_update(void) {}
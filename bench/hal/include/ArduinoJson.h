@@ -0,0 +1,51 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+#ifndef _BENCH_ARDUINOJSON_H_
+#define _BENCH_ARDUINOJSON_H_
+
+// Just the ArduinoJson surface config_utils.cpp compiles against, so the bench can use the real config
+// load/save path without fetching the library. Nothing in the bench imports JSON: deserializeJson()
+// always fails and every value reads as null.
+
+#include <stddef.h>
+
+class JsonObject {};
+class JsonArrayConst;
+class JsonObjectConst;
+
+class JsonVariantConst {
+public:
+    template <typename T> bool is() const { return false; }
+    template <typename T> T as() const { return T(); }
+    JsonVariantConst operator[](const char*) const { return JsonVariantConst(); }
+    JsonVariantConst operator[](size_t) const { return JsonVariantConst(); }
+    bool containsKey(const char*) const { return false; }
+    size_t size() const { return 0; }
+};
+
+class JsonObjectConst : public JsonVariantConst {};
+class JsonArrayConst : public JsonVariantConst {};
+
+class DynamicJsonDocument : public JsonVariantConst {
+public:
+    explicit DynamicJsonDocument(size_t) {}
+};
+
+class DeserializationError {
+public:
+    enum Code { Ok, InvalidInput };
+    DeserializationError(Code code) : code(code) {}
+    bool operator!=(Code other) const { return code != other; }
+    bool operator==(Code other) const { return code == other; }
+private:
+    Code code;
+};
+
+inline DeserializationError deserializeJson(DynamicJsonDocument&, const char*, size_t) {
+    return DeserializationError::InvalidInput;
+}
+
+#endif
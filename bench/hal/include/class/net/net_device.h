@@ -0,0 +1,34 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+#ifndef _BENCH_CLASS_NET_DEVICE_H_
+#define _BENCH_CLASS_NET_DEVICE_H_
+
+#include "tusb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void netd_init(void);
+void netd_reset(uint8_t rhport);
+uint16_t netd_open(uint8_t rhport, tusb_desc_interface_t const *itf_desc, uint16_t max_len);
+bool netd_control_xfer_cb(uint8_t rhport, uint8_t stage, tusb_control_request_t const *request);
+bool netd_xfer_cb(uint8_t rhport, uint8_t ep_addr, xfer_result_t result, uint32_t xferred_bytes);
+
+extern uint8_t tud_network_mac_address[6];
+bool tud_network_can_xmit(uint16_t size);
+void tud_network_xmit(void *ref, uint16_t arg);
+void tud_network_recv_renew(void);
+
+bool tud_network_recv_cb(const uint8_t *src, uint16_t size);
+uint16_t tud_network_xmit_cb(uint8_t *dst, void *ref, uint16_t arg);
+void tud_network_init_cb(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
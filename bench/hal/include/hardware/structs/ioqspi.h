@@ -0,0 +1,26 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+#ifndef _BENCH_HARDWARE_STRUCTS_IOQSPI_H_
+#define _BENCH_HARDWARE_STRUCTS_IOQSPI_H_
+
+#include "pico.h"
+
+#define IO_QSPI_GPIO_QSPI_SS_CTRL_OEOVER_LSB 12
+#define IO_QSPI_GPIO_QSPI_SS_CTRL_OEOVER_BITS 0x00003000
+
+typedef struct {
+    io_ro_32 status;
+    io_rw_32 ctrl;
+} ioqspi_status_ctrl_hw_t;
+
+typedef struct {
+    ioqspi_status_ctrl_hw_t io[6];
+} ioqspi_hw_t;
+
+extern ioqspi_hw_t ioqspi_hw_host;
+#define ioqspi_hw (&ioqspi_hw_host)
+
+#endif
@@ -0,0 +1,21 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+#ifndef _BENCH_HARDWARE_STRUCTS_SIO_H_
+#define _BENCH_HARDWARE_STRUCTS_SIO_H_
+
+#include "pico.h"
+
+typedef struct {
+    io_ro_32 cpuid;
+    io_ro_32 gpio_in;
+    io_ro_32 gpio_hi_in;
+} sio_hw_t;
+
+// gpio_hi_in is the QSPI bank, where BOOTSEL reads high (released)
+extern sio_hw_t sio_hw_host;
+#define sio_hw (&sio_hw_host)
+
+#endif
@@ -0,0 +1,32 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+#ifndef _BENCH_HARDWARE_STRUCTS_SYSTICK_H_
+#define _BENCH_HARDWARE_STRUCTS_SYSTICK_H_
+
+#include "pico.h"
+
+#ifdef __cplusplus
+// SysTick's current value reads the host cycle counter, counting down through 24 bits like the real
+// one, so PerfStats times stages in host cycles without knowing it's not on a device
+uint64_t bench_host_cycles(void);
+
+struct systick_cvr_t {
+    operator uint32_t() const { return (uint32_t)(~bench_host_cycles()) & 0x00FFFFFF; }
+    systick_cvr_t& operator=(uint32_t) { return *this; }
+};
+
+typedef struct {
+    io_rw_32 csr;
+    io_rw_32 rvr;
+    systick_cvr_t cvr;
+    io_ro_32 calib;
+} systick_hw_t;
+
+extern systick_hw_t systick_hw_host;
+#define systick_hw (&systick_hw_host)
+#endif
+
+#endif
@@ -0,0 +1,24 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+#ifndef _BENCH_HARDWARE_STRUCTS_USB_H_
+#define _BENCH_HARDWARE_STRUCTS_USB_H_
+
+#include "pico.h"
+
+#define USB_SOF_RD_BITS 0x000007ff
+
+typedef struct {
+    io_rw_32 dev_addr_ctrl;
+    io_rw_32 int_ep_addr_ctrl[15];
+    io_rw_32 main_ctrl;
+    io_wo_32 sof_wr;
+    io_ro_32 sof_rd;
+} usb_hw_t;
+
+extern usb_hw_t usb_hw_host;
+#define usb_hw (&usb_hw_host)
+
+#endif
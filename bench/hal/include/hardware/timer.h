@@ -0,0 +1,41 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+#ifndef _BENCH_HARDWARE_TIMER_H_
+#define _BENCH_HARDWARE_TIMER_H_
+
+#include "pico.h"
+#include "hardware/irq.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    io_wo_32 timehw;
+    io_wo_32 timelw;
+    io_ro_32 timehr;
+    io_ro_32 timelr;
+    io_rw_32 alarm[4];
+    io_rw_32 armed;
+    io_ro_32 timerawh;
+    io_ro_32 timerawl;
+    io_rw_32 dbgpause;
+    io_rw_32 pause;
+    io_rw_32 intr;
+    io_rw_32 inte;
+    io_rw_32 intf;
+    io_ro_32 ints;
+} timer_hw_t;
+
+// Alarms can be armed but never fire, nothing on the host services TIMER_IRQ_*
+extern timer_hw_t timer_hw_host;
+#define timer_hw (&timer_hw_host)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,12 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+#ifndef _BENCH_HOST_USBH_H_
+#define _BENCH_HOST_USBH_H_
+
+// The host API lives in tusb.h alongside the device side
+#include "tusb.h"
+
+#endif
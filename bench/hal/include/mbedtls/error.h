@@ -0,0 +1,11 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+#ifndef _BENCH_MBEDTLS_ERROR_H_
+#define _BENCH_MBEDTLS_ERROR_H_
+
+#define MBEDTLS_ERR_ERROR_GENERIC_ERROR -0x0001
+
+#endif
@@ -0,0 +1,62 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+#ifndef _BENCH_MBEDTLS_RSA_H_
+#define _BENCH_MBEDTLS_RSA_H_
+
+// mbedtls 2.x RSA API as PS4Auth uses it. The bench never signs anything, the calls fail cleanly.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef uint32_t mbedtls_mpi_uint;
+
+typedef struct mbedtls_mpi {
+    int s;
+    size_t n;
+    mbedtls_mpi_uint *p;
+} mbedtls_mpi;
+
+typedef enum {
+    MBEDTLS_MD_NONE = 0,
+    MBEDTLS_MD_SHA256 = 6,
+} mbedtls_md_type_t;
+
+#define MBEDTLS_RSA_PUBLIC 0
+#define MBEDTLS_RSA_PRIVATE 1
+#define MBEDTLS_RSA_PKCS_V15 0
+#define MBEDTLS_RSA_PKCS_V21 1
+
+typedef struct mbedtls_rsa_context {
+    int ver;
+    size_t len;
+    int padding;
+    int hash_id;
+} mbedtls_rsa_context;
+
+void mbedtls_rsa_init(mbedtls_rsa_context *ctx, int padding, int hash_id);
+int mbedtls_rsa_import(mbedtls_rsa_context *ctx, const mbedtls_mpi *N, const mbedtls_mpi *P, const mbedtls_mpi *Q, const mbedtls_mpi *D, const mbedtls_mpi *E);
+int mbedtls_rsa_complete(mbedtls_rsa_context *ctx);
+int mbedtls_rsa_export_raw(const mbedtls_rsa_context *ctx,
+                           unsigned char *N, size_t N_len,
+                           unsigned char *P, size_t P_len,
+                           unsigned char *Q, size_t Q_len,
+                           unsigned char *D, size_t D_len,
+                           unsigned char *E, size_t E_len);
+int mbedtls_rsa_rsassa_pss_sign(mbedtls_rsa_context *ctx,
+                                int (*f_rng)(void *, unsigned char *, size_t), void *p_rng,
+                                int mode, mbedtls_md_type_t md_alg, unsigned int hashlen,
+                                const unsigned char *hash, unsigned char *sig);
+void mbedtls_rsa_free(mbedtls_rsa_context *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
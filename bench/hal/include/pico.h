@@ -0,0 +1,219 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+#ifndef _BENCH_PICO_H_
+#define _BENCH_PICO_H_
+
+// Host stand-in for the parts of the pico-sdk the Core0 pipeline uses. Every pico/ and hardware/
+// header in bench/hal/include pulls this in and adds the declarations for its own module, the
+// definitions live in bench/hal/hal.cpp. Nothing here talks to hardware: time is the bench's virtual
+// clock, the GPIO bank is whatever the trace says, and the peripherals are inert.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <assert.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PICO_SDK_VERSION_MAJOR 2
+#define PICO_SDK_VERSION_MINOR 1
+#define PICO_SDK_VERSION_REVISION 1
+#define PICO_SDK_VERSION_STRING "2.1.1"
+
+#define PICO_ON_DEVICE 0
+#define PICO_NO_HARDWARE 1
+#define PICO_RP2040 1
+#define PICO_FLASH_SIZE_BYTES (2 * 1024 * 1024)
+#define PICO_DEFAULT_LED_PIN 25
+#define PICO_DEFAULT_I2C_INSTANCE() i2c0
+#define PICO_DEFAULT_I2C_SDA_PIN 4
+#define PICO_DEFAULT_I2C_SCL_PIN 5
+#define PICO_DEFAULT_SPI_INSTANCE() spi0
+#define PICO_DEFAULT_SPI_SCK_PIN 18
+#define PICO_DEFAULT_SPI_TX_PIN 19
+#define PICO_DEFAULT_SPI_RX_PIN 16
+#define PICO_DEFAULT_SPI_CSN_PIN 17
+#define PICO_UNIQUE_BOARD_ID_SIZE_BYTES 8
+
+#define NUM_CORES 2
+#define NUM_BANK0_GPIOS 30
+#define NUM_DMA_CHANNELS 12
+#define NUM_DMA_TIMERS 4
+#define NUM_SPIN_LOCKS 32
+
+#define XIP_BASE 0x10000000
+#define SRAM_BASE 0x20000000
+
+#define KHZ 1000
+#define MHZ 1000000
+
+#define _u(x) x ## u
+
+#define PICO_OK 0
+#define PICO_ERROR_NONE 0
+#define PICO_ERROR_GENERIC -1
+#define PICO_ERROR_TIMEOUT -2
+
+#ifndef MIN
+#define MIN(a, b) ((b) < (a) ? (b) : (a))
+#endif
+#ifndef MAX
+#define MAX(a, b) ((a) < (b) ? (b) : (a))
+#endif
+#define count_of(a) (sizeof(a) / sizeof((a)[0]))
+
+// Sections and placement mean nothing on the host
+#define __not_in_flash(group)
+#define __not_in_flash_func(func_name) func_name
+#define __no_inline_not_in_flash_func(func_name) __attribute__((noinline)) func_name
+#define __time_critical_func(func_name) func_name
+#define __in_flash(group)
+#define __scratch_x(group)
+#define __scratch_y(group)
+#define __uninitialized_ram(var) var
+#define __force_inline inline __attribute__((always_inline))
+#define __packed __attribute__((packed))
+#define __aligned(x) __attribute__((aligned(x)))
+#define __unused __attribute__((unused))
+#define __weak __attribute__((weak))
+#define __isr
+
+typedef unsigned int uint;
+
+typedef volatile uint32_t io_rw_32;
+typedef const volatile uint32_t io_ro_32;
+typedef volatile uint32_t io_wo_32;
+typedef volatile uint16_t io_rw_16;
+typedef volatile uint8_t io_rw_8;
+
+// Spin loops waiting on the clock would never finish with virtual time, so each turn moves it on 1 us
+void tight_loop_contents(void);
+static inline void __dmb(void) { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+static inline void __sev(void) {}
+static inline void __wfe(void) {}
+static inline void __wfi(void) {}
+static inline void __compiler_memory_barrier(void) { __asm__ volatile ("" : : : "memory"); }
+
+static inline void hw_set_bits(io_rw_32 *addr, uint32_t mask) { *addr |= mask; }
+static inline void hw_clear_bits(io_rw_32 *addr, uint32_t mask) { *addr &= ~mask; }
+static inline void hw_write_masked(io_rw_32 *addr, uint32_t values, uint32_t write_mask) {
+    *addr = (*addr & ~write_mask) | (values & write_mask);
+}
+
+// The bench runs everything on one thread, as Core0
+uint get_core_num(void);
+
+void panic(const char *fmt, ...);
+#define hard_assert(x) assert(x)
+#define invalid_params_if(x, test) ((void)0)
+#define valid_params_if(x, test) ((void)0)
+
+// time
+typedef uint64_t absolute_time_t;
+#define nil_time ((absolute_time_t)0)
+#define at_the_end_of_time ((absolute_time_t)0x7fffffffffffffffull)
+
+uint64_t time_us_64(void);
+uint32_t time_us_32(void);
+static inline absolute_time_t get_absolute_time(void) { return time_us_64(); }
+static inline uint64_t to_us_since_boot(absolute_time_t t) { return t; }
+static inline uint32_t to_ms_since_boot(absolute_time_t t) { return (uint32_t)(t / 1000); }
+static inline absolute_time_t from_us_since_boot(uint64_t us) { return us; }
+static inline void update_us_since_boot(absolute_time_t *t, uint64_t us) { *t = us; }
+static inline bool is_nil_time(absolute_time_t t) { return t == nil_time; }
+static inline bool is_at_the_end_of_time(absolute_time_t t) { return t == at_the_end_of_time; }
+static inline absolute_time_t delayed_by_us(absolute_time_t t, uint64_t us) { return t + us; }
+static inline absolute_time_t delayed_by_ms(absolute_time_t t, uint32_t ms) { return t + (uint64_t)ms * 1000; }
+static inline absolute_time_t make_timeout_time_us(uint64_t us) { return get_absolute_time() + us; }
+static inline absolute_time_t make_timeout_time_ms(uint32_t ms) { return get_absolute_time() + (uint64_t)ms * 1000; }
+static inline int64_t absolute_time_diff_us(absolute_time_t from, absolute_time_t to) { return (int64_t)(to - from); }
+static inline absolute_time_t absolute_time_min(absolute_time_t a, absolute_time_t b) { return a < b ? a : b; }
+static inline bool time_reached(absolute_time_t t) { return get_absolute_time() >= t; }
+
+// Anything that would block moves the virtual clock forward instead
+void busy_wait_us(uint64_t delay_us);
+void busy_wait_us_32(uint32_t delay_us);
+void busy_wait_ms(uint32_t delay_ms);
+void busy_wait_until(absolute_time_t t);
+void sleep_us(uint64_t us);
+void sleep_ms(uint32_t ms);
+void sleep_until(absolute_time_t t);
+
+// sync
+typedef volatile uint32_t spin_lock_t;
+uint32_t save_and_disable_interrupts(void);
+void restore_interrupts(uint32_t status);
+spin_lock_t *spin_lock_instance(uint lock_num);
+int spin_lock_claim_unused(bool required);
+void spin_lock_claim(uint lock_num);
+void spin_lock_unclaim(uint lock_num);
+spin_lock_t *spin_lock_init(uint lock_num);
+uint32_t spin_lock_blocking(spin_lock_t *lock);
+void spin_unlock(spin_lock_t *lock, uint32_t saved_irq);
+static inline void spin_lock_unsafe_blocking(spin_lock_t *lock) { (void)lock; }
+static inline void spin_unlock_unsafe(spin_lock_t *lock) { (void)lock; }
+static inline bool is_spin_locked(spin_lock_t *lock) { (void)lock; return false; }
+
+typedef struct {
+    spin_lock_t *spin_lock;
+    uint32_t save;
+} critical_section_t;
+void critical_section_init(critical_section_t *crit_sec);
+void critical_section_init_with_lock_num(critical_section_t *crit_sec, uint lock_num);
+void critical_section_enter_blocking(critical_section_t *crit_sec);
+void critical_section_exit(critical_section_t *crit_sec);
+void critical_section_deinit(critical_section_t *crit_sec);
+static inline bool critical_section_is_initialized(critical_section_t *crit_sec) { return crit_sec->spin_lock != 0; }
+
+typedef struct {
+    spin_lock_t *spin_lock;
+} lock_core_t;
+
+typedef struct {
+    lock_core_t core;
+    int8_t owner;
+} mutex_t;
+void mutex_init(mutex_t *mtx);
+void mutex_enter_blocking(mutex_t *mtx);
+bool mutex_try_enter(mutex_t *mtx, uint32_t *owner_out);
+void mutex_exit(mutex_t *mtx);
+
+// multicore
+void multicore_launch_core1(void (*entry)(void));
+void multicore_reset_core1(void);
+void multicore_lockout_victim_init(void);
+bool multicore_lockout_victim_is_initialized(uint core_num);
+void multicore_lockout_start_blocking(void);
+bool multicore_lockout_start_timeout_us(uint64_t timeout_us);
+void multicore_lockout_end_blocking(void);
+bool multicore_lockout_end_timeout_us(uint64_t timeout_us);
+void multicore_fifo_push_blocking(uint32_t data);
+uint32_t multicore_fifo_pop_blocking(void);
+bool multicore_fifo_rvalid(void);
+bool multicore_fifo_wready(void);
+void multicore_fifo_drain(void);
+
+// misc
+bool stdio_init_all(void);
+void reset_usb_boot(uint32_t usb_activity_gpio_pin_mask, uint32_t disable_interface_mask);
+uint32_t get_rand_32(void);
+uint64_t get_rand_64(void);
+
+typedef struct {
+    uint8_t id[PICO_UNIQUE_BOARD_ID_SIZE_BYTES];
+} pico_unique_board_id_t;
+void pico_get_unique_board_id(pico_unique_board_id_t *id_out);
+void pico_get_unique_board_id_string(char *id_out, uint len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,14 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+#ifndef _BENCH_PICO_BINARY_INFO_H_
+#define _BENCH_PICO_BINARY_INFO_H_
+
+#include "pico.h"
+
+#define bi_decl(...)
+#define bi_decl_if_func_used(...)
+
+#endif
@@ -0,0 +1,11 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+#ifndef _BENCH_PICO_LOCK_CORE_H_
+#define _BENCH_PICO_LOCK_CORE_H_
+
+#include "pico.h"
+
+#endif
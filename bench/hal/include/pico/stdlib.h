@@ -0,0 +1,15 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+#ifndef _BENCH_PICO_STDLIB_H_
+#define _BENCH_PICO_STDLIB_H_
+
+#include "pico.h"
+#include "hardware/gpio.h"
+#include "hardware/clocks.h"
+#include "hardware/timer.h"
+#include "hardware/sync.h"
+
+#endif
@@ -0,0 +1,38 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+#ifndef _BENCH_PIO_USB_H_
+#define _BENCH_PIO_USB_H_
+
+// Pico-PIO-USB's configuration block, which the USB peripheral fills in and hands to tuh_configure()
+
+#include "pico.h"
+
+// Pico-PIO-USB's device table, only ever held as a pointer here
+typedef struct usb_device_t usb_device_t;
+
+typedef enum {
+    PIO_USB_PINOUT_DPDM = 0,
+    PIO_USB_PINOUT_DMDP,
+} PIO_USB_PINOUT;
+
+typedef struct {
+    uint8_t pin_dp;
+    uint8_t pio_tx_num;
+    uint8_t sm_tx;
+    uint8_t tx_ch;
+    uint8_t pio_rx_num;
+    uint8_t sm_rx;
+    uint8_t sm_eop;
+    void *alarm_pool;
+    int8_t debug_pin_rx;
+    int8_t debug_pin_eop;
+    bool skip_alarm_pool;
+    PIO_USB_PINOUT pinout;
+} pio_usb_configuration_t;
+
+#define PIO_USB_DEFAULT_CONFIG { 0, 0, 0, 0, 1, 0, 1, NULL, -1, -1, false, PIO_USB_PINOUT_DPDM }
+
+#endif
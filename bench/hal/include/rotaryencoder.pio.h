@@ -0,0 +1,31 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+#ifndef _BENCH_ROTARYENCODER_PIO_H_
+#define _BENCH_ROTARYENCODER_PIO_H_
+
+// Stands in for pioasm's output of src/addons/rotaryencoder.pio. The host PIO never counts, so
+// an encoder on the PIO path sits still.
+
+#include "hardware/pio.h"
+
+static const uint16_t rotary_encoder_program_instructions[] = { 0 };
+static const pio_program_t rotary_encoder_program = {
+    .instructions = rotary_encoder_program_instructions,
+    .length = 1,
+    .origin = -1,
+};
+
+static inline void rotary_encoder_program_init(PIO pio, uint sm, uint offset, uint pinA, uint pinB) {
+    (void)offset; (void)pinA; (void)pinB;
+    pio_sm_set_enabled(pio, sm, true);
+}
+
+static inline int32_t rotary_encoder_get_count(PIO pio, uint sm) {
+    (void)pio; (void)sm;
+    return 0;
+}
+
+#endif
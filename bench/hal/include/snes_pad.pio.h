@@ -0,0 +1,28 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+#ifndef _BENCH_SNES_PAD_PIO_H_
+#define _BENCH_SNES_PAD_PIO_H_
+
+// Stands in for pioasm's output of lib/SNESpad/snes_pad.pio. The host PIO never runs a program,
+// so the RX FIFO stays empty and SNESpad sees no controller.
+
+#include "hardware/pio.h"
+
+#define snes_pad_CYCLES_PER_READ 434
+
+static const uint16_t snes_pad_program_instructions[] = { 0 };
+static const pio_program_t snes_pad_program = {
+    .instructions = snes_pad_program_instructions,
+    .length = 1,
+    .origin = -1,
+};
+
+static inline void snes_pad_program_init(PIO pio, uint sm, uint offset, uint clockPin, uint latchPin, uint dataPin, uint32_t idleCycles) {
+    (void)offset; (void)clockPin; (void)latchPin; (void)dataPin; (void)idleCycles;
+    pio_sm_set_enabled(pio, sm, true);
+}
+
+#endif
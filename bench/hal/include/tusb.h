@@ -0,0 +1,402 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+#ifndef _BENCH_TUSB_H_
+#define _BENCH_TUSB_H_
+
+// Host stand-in for the slice of TinyUSB the drivers compile against. Types and descriptor macros
+// keep TinyUSB's layout so the drivers' descriptors come out the same size, the functions are in
+// bench/hal/tinyusb.cpp. There is no bus: the device is always mounted and ready, every IN report
+// is taken straight away and counted, and the host stack never sees a device attach.
+
+#include "pico.h"
+#include "tusb_option.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//--------------------------------------------------------------------+
+// Common
+//--------------------------------------------------------------------+
+#define TU_ATTR_PACKED __attribute__((packed))
+#define TU_ATTR_WEAK __attribute__((weak))
+#define TU_ATTR_ALWAYS_INLINE __attribute__((always_inline))
+#define TU_ATTR_ALIGNED(x) __attribute__((aligned(x)))
+#define TU_ATTR_UNUSED __attribute__((unused))
+#define TU_ATTR_PACKED_BEGIN
+#define TU_ATTR_PACKED_END
+#define TU_ATTR_BIT_FIELD_ORDER_BEGIN
+#define TU_ATTR_BIT_FIELD_ORDER_END
+
+#define TU_ARRAY_SIZE(_arr) (sizeof(_arr) / sizeof(_arr[0]))
+#define TU_MIN(_x, _y) (((_x) < (_y)) ? (_x) : (_y))
+#define TU_MAX(_x, _y) (((_x) > (_y)) ? (_x) : (_y))
+#define TU_BIT(n) (1UL << (n))
+#define TU_U16(_high, _low) ((uint16_t)(((_high) << 8) | (_low)))
+#define TU_U16_HIGH(_u16) ((uint8_t)(((_u16) >> 8) & 0x00ff))
+#define TU_U16_LOW(_u16) ((uint8_t)((_u16) & 0x00ff))
+#define U16_TO_U8S_LE(_u16) TU_U16_LOW(_u16), TU_U16_HIGH(_u16)
+#define U32_TO_U8S_LE(_u32) ((uint8_t)(_u32)), ((uint8_t)((_u32) >> 8)), ((uint8_t)((_u32) >> 16)), ((uint8_t)((_u32) >> 24))
+
+#define tu_memclr(buffer, size) memset((buffer), 0, (size))
+#define tu_varclr(_var) tu_memclr(_var, sizeof(*(_var)))
+
+static inline uint16_t tu_u16(uint8_t high, uint8_t low) { return (uint16_t)((((uint16_t)high) << 8) | low); }
+static inline uint16_t tu_le16toh(uint16_t x) { return x; }
+static inline uint16_t tu_htole16(uint16_t x) { return x; }
+static inline uint32_t tu_le32toh(uint32_t x) { return x; }
+static inline uint32_t tu_htole32(uint32_t x) { return x; }
+
+#define TU_LOG1(...)
+#define TU_LOG2(...)
+#define TU_LOG_FAILED()
+#define TU_BREAKPOINT()
+
+// TU_VERIFY(cond) / TU_VERIFY(cond, ret) and TU_ASSERT likewise; the bare form returns false
+#define _TU_GET_3RD_ARG(arg1, arg2, arg3, ...) arg3
+#define _TU_VERIFY_1ARG(_cond) do { if (!(_cond)) return false; } while (0)
+#define _TU_VERIFY_2ARGS(_cond, _ret) do { if (!(_cond)) return _ret; } while (0)
+#define TU_VERIFY(...) _TU_GET_3RD_ARG(__VA_ARGS__, _TU_VERIFY_2ARGS, _TU_VERIFY_1ARG, _dummy)(__VA_ARGS__)
+#define TU_ASSERT(...) TU_VERIFY(__VA_ARGS__)
+
+//--------------------------------------------------------------------+
+// Types
+//--------------------------------------------------------------------+
+typedef enum {
+    TUSB_XFER_CONTROL = 0,
+    TUSB_XFER_ISOCHRONOUS,
+    TUSB_XFER_BULK,
+    TUSB_XFER_INTERRUPT
+} tusb_xfer_type_t;
+
+typedef enum {
+    TUSB_DIR_OUT = 0,
+    TUSB_DIR_IN = 1,
+    TUSB_DIR_IN_MASK = 0x80
+} tusb_dir_t;
+
+typedef enum {
+    TUSB_SPEED_FULL = 0,
+    TUSB_SPEED_LOW = 1,
+    TUSB_SPEED_HIGH = 2,
+    TUSB_SPEED_INVALID = 0xff,
+} tusb_speed_t;
+
+typedef enum {
+    TUSB_DESC_DEVICE = 0x01,
+    TUSB_DESC_CONFIGURATION = 0x02,
+    TUSB_DESC_STRING = 0x03,
+    TUSB_DESC_INTERFACE = 0x04,
+    TUSB_DESC_ENDPOINT = 0x05,
+    TUSB_DESC_DEVICE_QUALIFIER = 0x06,
+    TUSB_DESC_OTHER_SPEED_CONFIG = 0x07,
+    TUSB_DESC_INTERFACE_POWER = 0x08,
+    TUSB_DESC_OTG = 0x09,
+    TUSB_DESC_DEBUG = 0x0A,
+    TUSB_DESC_INTERFACE_ASSOCIATION = 0x0B,
+    TUSB_DESC_BOS = 0x0F,
+    TUSB_DESC_DEVICE_CAPABILITY = 0x10,
+    TUSB_DESC_CS_DEVICE = 0x21,
+    TUSB_DESC_CS_CONFIGURATION = 0x22,
+    TUSB_DESC_CS_STRING = 0x23,
+    TUSB_DESC_CS_INTERFACE = 0x24,
+    TUSB_DESC_CS_ENDPOINT = 0x25,
+} tusb_desc_type_t;
+
+typedef enum {
+    TUSB_REQ_GET_STATUS = 0,
+    TUSB_REQ_CLEAR_FEATURE = 1,
+    TUSB_REQ_SET_FEATURE = 3,
+    TUSB_REQ_SET_ADDRESS = 5,
+    TUSB_REQ_GET_DESCRIPTOR = 6,
+    TUSB_REQ_SET_DESCRIPTOR = 7,
+    TUSB_REQ_GET_CONFIGURATION = 8,
+    TUSB_REQ_SET_CONFIGURATION = 9,
+    TUSB_REQ_GET_INTERFACE = 10,
+    TUSB_REQ_SET_INTERFACE = 11,
+    TUSB_REQ_SYNCH_FRAME = 12
+} tusb_request_code_t;
+
+typedef enum {
+    TUSB_REQ_TYPE_STANDARD = 0,
+    TUSB_REQ_TYPE_CLASS,
+    TUSB_REQ_TYPE_VENDOR,
+    TUSB_REQ_TYPE_INVALID
+} tusb_request_type_t;
+
+typedef enum {
+    TUSB_REQ_RCPT_DEVICE = 0,
+    TUSB_REQ_RCPT_INTERFACE,
+    TUSB_REQ_RCPT_ENDPOINT,
+    TUSB_REQ_RCPT_OTHER
+} tusb_request_recipient_t;
+
+typedef enum {
+    TUSB_CLASS_UNSPECIFIED = 0,
+    TUSB_CLASS_AUDIO = 1,
+    TUSB_CLASS_CDC = 2,
+    TUSB_CLASS_HID = 3,
+    TUSB_CLASS_MSC = 8,
+    TUSB_CLASS_HUB = 9,
+    TUSB_CLASS_CDC_DATA = 10,
+    TUSB_CLASS_MISC = 0xEF,
+    TUSB_CLASS_APPLICATION_SPECIFIC = 0xFE,
+    TUSB_CLASS_VENDOR_SPECIFIC = 0xFF
+} tusb_class_code_t;
+
+typedef enum {
+    MISC_SUBCLASS_COMMON = 2
+} misc_subclass_type_t;
+
+typedef enum {
+    MISC_PROTOCOL_IAD = 1
+} misc_protocol_type_t;
+
+enum {
+    TUSB_DESC_CONFIG_ATT_REMOTE_WAKEUP = TU_BIT(5),
+    TUSB_DESC_CONFIG_ATT_SELF_POWERED = TU_BIT(6),
+};
+
+#define TUSB_DESC_CONFIG_POWER_MA(x) ((x) / 2)
+
+typedef enum {
+    XFER_RESULT_SUCCESS = 0,
+    XFER_RESULT_FAILED,
+    XFER_RESULT_STALLED,
+    XFER_RESULT_TIMEOUT,
+    XFER_RESULT_INVALID
+} xfer_result_t;
+
+enum {
+    CONTROL_STAGE_IDLE,
+    CONTROL_STAGE_SETUP,
+    CONTROL_STAGE_DATA,
+    CONTROL_STAGE_ACK
+};
+
+typedef struct TU_ATTR_PACKED {
+    uint8_t bLength;
+    uint8_t bDescriptorType;
+    uint16_t bcdUSB;
+    uint8_t bDeviceClass;
+    uint8_t bDeviceSubClass;
+    uint8_t bDeviceProtocol;
+    uint8_t bMaxPacketSize0;
+    uint16_t idVendor;
+    uint16_t idProduct;
+    uint16_t bcdDevice;
+    uint8_t iManufacturer;
+    uint8_t iProduct;
+    uint8_t iSerialNumber;
+    uint8_t bNumConfigurations;
+} tusb_desc_device_t;
+
+typedef struct TU_ATTR_PACKED {
+    uint8_t bLength;
+    uint8_t bDescriptorType;
+    uint16_t bcdUSB;
+    uint8_t bDeviceClass;
+    uint8_t bDeviceSubClass;
+    uint8_t bDeviceProtocol;
+    uint8_t bMaxPacketSize0;
+    uint8_t bNumConfigurations;
+    uint8_t bReserved;
+} tusb_desc_device_qualifier_t;
+
+typedef struct TU_ATTR_PACKED {
+    uint8_t bLength;
+    uint8_t bDescriptorType;
+    uint16_t wTotalLength;
+    uint8_t bNumInterfaces;
+    uint8_t bConfigurationValue;
+    uint8_t iConfiguration;
+    uint8_t bmAttributes;
+    uint8_t bMaxPower;
+} tusb_desc_configuration_t;
+
+typedef struct TU_ATTR_PACKED {
+    uint8_t bLength;
+    uint8_t bDescriptorType;
+    uint8_t bInterfaceNumber;
+    uint8_t bAlternateSetting;
+    uint8_t bNumEndpoints;
+    uint8_t bInterfaceClass;
+    uint8_t bInterfaceSubClass;
+    uint8_t bInterfaceProtocol;
+    uint8_t iInterface;
+} tusb_desc_interface_t;
+
+typedef struct TU_ATTR_PACKED {
+    uint8_t bLength;
+    uint8_t bDescriptorType;
+    uint8_t bEndpointAddress;
+    struct TU_ATTR_PACKED {
+        uint8_t xfer : 2;
+        uint8_t sync : 2;
+        uint8_t usage : 2;
+        uint8_t : 2;
+    } bmAttributes;
+    uint16_t wMaxPacketSize;
+    uint8_t bInterval;
+} tusb_desc_endpoint_t;
+
+typedef struct TU_ATTR_PACKED {
+    union {
+        struct TU_ATTR_PACKED {
+            uint8_t recipient : 5;
+            uint8_t type : 2;
+            uint8_t direction : 1;
+        } bmRequestType_bit;
+        uint8_t bmRequestType;
+    };
+    uint8_t bRequest;
+    uint16_t wValue;
+    uint16_t wIndex;
+    uint16_t wLength;
+} tusb_control_request_t;
+
+static inline tusb_dir_t tu_edpt_dir(uint8_t addr) { return (addr & TUSB_DIR_IN_MASK) ? TUSB_DIR_IN : TUSB_DIR_OUT; }
+static inline uint8_t tu_edpt_number(uint8_t addr) { return (uint8_t)(addr & (~TUSB_DIR_IN_MASK)); }
+static inline uint8_t tu_edpt_addr(uint8_t num, uint8_t dir) { return (uint8_t)(num | (dir ? TUSB_DIR_IN_MASK : 0)); }
+static inline uint16_t tu_edpt_packet_size(tusb_desc_endpoint_t const *desc_ep) { return desc_ep->wMaxPacketSize & 0x7FF; }
+static inline uint8_t const *tu_desc_next(void const *desc) { uint8_t const *desc8 = (uint8_t const *)desc; return desc8 + desc8[0]; }
+static inline uint8_t tu_desc_type(void const *desc) { return ((uint8_t const *)desc)[1]; }
+static inline uint8_t tu_desc_len(void const *desc) { return ((uint8_t const *)desc)[0]; }
+
+//--------------------------------------------------------------------+
+// Descriptor templates, same bytes as TinyUSB's usbd.h
+//--------------------------------------------------------------------+
+#define TUD_CONFIG_DESC_LEN (9)
+#define TUD_CONFIG_DESCRIPTOR(config_num, _itfcount, _stridx, _total_len, _attribute, _power_ma) \
+    9, TUSB_DESC_CONFIGURATION, U16_TO_U8S_LE(_total_len), _itfcount, config_num, _stridx, TU_BIT(7) | _attribute, (_power_ma) / 2
+
+#define HID_DESC_TYPE_HID 0x21
+#define HID_DESC_TYPE_REPORT 0x22
+
+#define TUD_HID_DESC_LEN (9 + 9 + 7)
+#define TUD_HID_DESCRIPTOR(_itfnum, _stridx, _boot_protocol, _report_desc_len, _epin, _epsize, _ep_interval) \
+    9, TUSB_DESC_INTERFACE, _itfnum, 0, 1, TUSB_CLASS_HID, (uint8_t)((_boot_protocol) ? 1 : 0), _boot_protocol, _stridx, \
+    9, HID_DESC_TYPE_HID, U16_TO_U8S_LE(0x0111), 0, 1, HID_DESC_TYPE_REPORT, U16_TO_U8S_LE(_report_desc_len), \
+    7, TUSB_DESC_ENDPOINT, _epin, TUSB_XFER_INTERRUPT, U16_TO_U8S_LE(_epsize), _ep_interval
+
+#define TUD_MSC_DESC_LEN (9 + 7 + 7)
+#define TUD_MSC_DESCRIPTOR(_itfnum, _stridx, _epout, _epin, _epsize) \
+    9, TUSB_DESC_INTERFACE, _itfnum, 0, 2, TUSB_CLASS_MSC, 0x06, 0x50, _stridx, \
+    7, TUSB_DESC_ENDPOINT, _epout, TUSB_XFER_BULK, U16_TO_U8S_LE(_epsize), 0, \
+    7, TUSB_DESC_ENDPOINT, _epin, TUSB_XFER_BULK, U16_TO_U8S_LE(_epsize), 0
+
+#define TUD_RNDIS_DESC_LEN (8 + 9 + 5 + 5 + 4 + 5 + 7 + 9 + 7 + 7)
+#define TUD_RNDIS_DESCRIPTOR(_itfnum, _stridx, _ep_notif, _ep_notif_size, _epout, _epin, _epsize) \
+    8, TUSB_DESC_INTERFACE_ASSOCIATION, _itfnum, 2, TUSB_CLASS_MISC, 0x04, 0x01, 0, \
+    9, TUSB_DESC_INTERFACE, _itfnum, 0, 1, TUSB_CLASS_MISC, 0x04, 0x01, _stridx, \
+    5, TUSB_DESC_CS_INTERFACE, 0x00, U16_TO_U8S_LE(0x0110), \
+    5, TUSB_DESC_CS_INTERFACE, 0x01, 0, (uint8_t)((_itfnum) + 1), \
+    4, TUSB_DESC_CS_INTERFACE, 0x02, 0, \
+    5, TUSB_DESC_CS_INTERFACE, 0x06, _itfnum, (uint8_t)((_itfnum) + 1), \
+    7, TUSB_DESC_ENDPOINT, _ep_notif, TUSB_XFER_INTERRUPT, U16_TO_U8S_LE(_ep_notif_size), 1, \
+    9, TUSB_DESC_INTERFACE, (uint8_t)((_itfnum) + 1), 0, 2, TUSB_CLASS_CDC_DATA, 0, 0, 0, \
+    7, TUSB_DESC_ENDPOINT, _epout, TUSB_XFER_BULK, U16_TO_U8S_LE(_epsize), 0, \
+    7, TUSB_DESC_ENDPOINT, _epin, TUSB_XFER_BULK, U16_TO_U8S_LE(_epsize), 0
+
+#define TUD_CDC_ECM_DESC_LEN (8 + 9 + 5 + 5 + 13 + 7 + 9 + 9 + 7 + 7)
+#define TUD_CDC_ECM_DESCRIPTOR(_itfnum, _desc_stridx, _mac_stridx, _ep_notif, _ep_notif_size, _epout, _epin, _epsize, _maxsegmentsize) \
+    8, TUSB_DESC_INTERFACE_ASSOCIATION, _itfnum, 2, TUSB_CLASS_CDC, 0x06, 0, 0, \
+    9, TUSB_DESC_INTERFACE, _itfnum, 0, 1, TUSB_CLASS_CDC, 0x06, 0, _desc_stridx, \
+    5, TUSB_DESC_CS_INTERFACE, 0x00, U16_TO_U8S_LE(0x0120), \
+    5, TUSB_DESC_CS_INTERFACE, 0x06, _itfnum, (uint8_t)((_itfnum) + 1), \
+    13, TUSB_DESC_CS_INTERFACE, 0x0F, _mac_stridx, 0, 0, 0, 0, U16_TO_U8S_LE(_maxsegmentsize), U16_TO_U8S_LE(0), 0, \
+    7, TUSB_DESC_ENDPOINT, _ep_notif, TUSB_XFER_INTERRUPT, U16_TO_U8S_LE(_ep_notif_size), 1, \
+    9, TUSB_DESC_INTERFACE, (uint8_t)((_itfnum) + 1), 0, 0, TUSB_CLASS_CDC_DATA, 0, 0, 0, \
+    9, TUSB_DESC_INTERFACE, (uint8_t)((_itfnum) + 1), 1, 2, TUSB_CLASS_CDC_DATA, 0, 0, 0, \
+    7, TUSB_DESC_ENDPOINT, _epout, TUSB_XFER_BULK, U16_TO_U8S_LE(_epsize), 0, \
+    7, TUSB_DESC_ENDPOINT, _epin, TUSB_XFER_BULK, U16_TO_U8S_LE(_epsize), 0
+
+#define TUD_CDC_NCM_DESC_LEN (8 + 9 + 5 + 5 + 13 + 6 + 7 + 9 + 9 + 7 + 7)
+#define TUD_CDC_NCM_DESCRIPTOR(_itfnum, _desc_stridx, _mac_stridx, _ep_notif, _ep_notif_size, _epout, _epin, _epsize, _maxsegmentsize) \
+    8, TUSB_DESC_INTERFACE_ASSOCIATION, _itfnum, 2, TUSB_CLASS_CDC, 0x0D, 0, 0, \
+    9, TUSB_DESC_INTERFACE, _itfnum, 0, 1, TUSB_CLASS_CDC, 0x0D, 0, _desc_stridx, \
+    5, TUSB_DESC_CS_INTERFACE, 0x00, U16_TO_U8S_LE(0x0110), \
+    5, TUSB_DESC_CS_INTERFACE, 0x06, _itfnum, (uint8_t)((_itfnum) + 1), \
+    13, TUSB_DESC_CS_INTERFACE, 0x0F, _mac_stridx, 0, 0, 0, 0, U16_TO_U8S_LE(_maxsegmentsize), U16_TO_U8S_LE(0), 0, \
+    6, TUSB_DESC_CS_INTERFACE, 0x1A, U16_TO_U8S_LE(0x0100), 0, \
+    7, TUSB_DESC_ENDPOINT, _ep_notif, TUSB_XFER_INTERRUPT, U16_TO_U8S_LE(_ep_notif_size), 50, \
+    9, TUSB_DESC_INTERFACE, (uint8_t)((_itfnum) + 1), 0, 0, TUSB_CLASS_CDC_DATA, 0, 0x01, 0, \
+    9, TUSB_DESC_INTERFACE, (uint8_t)((_itfnum) + 1), 1, 2, TUSB_CLASS_CDC_DATA, 0, 0x01, 0, \
+    7, TUSB_DESC_ENDPOINT, _epout, TUSB_XFER_BULK, U16_TO_U8S_LE(_epsize), 0, \
+    7, TUSB_DESC_ENDPOINT, _epin, TUSB_XFER_BULK, U16_TO_U8S_LE(_epsize), 0
+
+//--------------------------------------------------------------------+
+// Device stack
+//--------------------------------------------------------------------+
+bool tud_init(uint8_t rhport);
+void tud_task(void);
+bool tud_mounted(void);
+bool tud_ready(void);
+bool tud_suspended(void);
+bool tud_connected(void);
+bool tud_remote_wakeup(void);
+bool tud_disconnect(void);
+bool tud_connect(void);
+bool tud_control_xfer(uint8_t rhport, tusb_control_request_t const *request, void *buffer, uint16_t len);
+bool tud_control_status(uint8_t rhport, tusb_control_request_t const *request);
+
+uint8_t const *tud_descriptor_device_cb(void);
+uint8_t const *tud_descriptor_configuration_cb(uint8_t index);
+uint16_t const *tud_descriptor_string_cb(uint8_t index, uint16_t langid);
+uint8_t const *tud_descriptor_device_qualifier_cb(void);
+void tud_mount_cb(void);
+void tud_umount_cb(void);
+void tud_suspend_cb(bool remote_wakeup_en);
+void tud_resume_cb(void);
+bool tud_vendor_control_xfer_cb(uint8_t rhport, uint8_t stage, tusb_control_request_t const *request);
+
+//--------------------------------------------------------------------+
+// Host stack
+//--------------------------------------------------------------------+
+#define TUH_CFGID_RPI_PIO_USB_CONFIGURATION 100
+
+struct tuh_xfer_s;
+typedef struct tuh_xfer_s tuh_xfer_t;
+typedef void (*tuh_xfer_cb_t)(tuh_xfer_t *xfer);
+
+struct tuh_xfer_s {
+    uint8_t daddr;
+    uint8_t ep_addr;
+    uint8_t reserved;
+    xfer_result_t result;
+    uint32_t actual_len;
+    union {
+        tusb_control_request_t const *setup;
+        uint32_t buflen;
+    };
+    uint8_t *buffer;
+    tuh_xfer_cb_t complete_cb;
+    uintptr_t user_data;
+};
+
+bool tuh_init(uint8_t rhport);
+bool tuh_deinit(uint8_t rhport);
+bool tuh_configure(uint8_t rhport, uint32_t cfg_id, const void *cfg_param);
+void tuh_task(void);
+bool tuh_inited(void);
+bool tuh_mounted(uint8_t daddr);
+bool tuh_ready(uint8_t daddr);
+bool tuh_vid_pid_get(uint8_t daddr, uint16_t *vid, uint16_t *pid);
+bool tuh_control_xfer(tuh_xfer_t *xfer);
+bool tuh_edpt_open(uint8_t daddr, tusb_desc_endpoint_t const *desc_ep);
+xfer_result_t tuh_descriptor_get_string_sync(uint8_t daddr, uint8_t index, uint16_t language_id, void *buffer, uint16_t len);
+
+void tuh_mount_cb(uint8_t daddr);
+void tuh_umount_cb(uint8_t daddr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#include "class/hid/hid.h"
+#include "class/hid/hid_host.h"
+
+#endif
@@ -0,0 +1,88 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+#ifndef _BENCH_TUSB_OPTION_H_
+#define _BENCH_TUSB_OPTION_H_
+
+// Just enough of TinyUSB's option list for headers/tusb_config.h to resolve as it does on the RP2040
+
+#define OPT_MCU_NONE 0
+#define OPT_MCU_LPC18XX 6
+#define OPT_MCU_LPC43XX 7
+#define OPT_MCU_MIMXRT10XX 700
+#define OPT_MCU_NUC505 802
+#define OPT_MCU_CXD56 1100
+#define OPT_MCU_RP2040 1900
+
+#define OPT_OS_NONE 1
+#define OPT_OS_FREERTOS 2
+#define OPT_OS_MYNEWT 3
+#define OPT_OS_CUSTOM 4
+#define OPT_OS_PICO 5
+
+#define OPT_MODE_NONE 0x0000
+#define OPT_MODE_DEVICE 0x0001
+#define OPT_MODE_HOST 0x0002
+#define OPT_MODE_SPEED_MASK 0xff00
+#define OPT_MODE_FULL_SPEED 0x0000
+#define OPT_MODE_LOW_SPEED 0x0100
+#define OPT_MODE_HIGH_SPEED 0x0200
+#define OPT_MODE_DEFAULT_SPEED 0x0000
+
+#ifndef CFG_TUSB_MCU
+#define CFG_TUSB_MCU OPT_MCU_RP2040
+#endif
+
+#ifndef CFG_TUSB_DEBUG
+#define CFG_TUSB_DEBUG 0
+#endif
+
+#include "tusb_config.h"
+
+#ifndef TUD_OPT_RHPORT
+#define TUD_OPT_RHPORT 0
+#endif
+
+#ifndef CFG_TUD_CDC
+#define CFG_TUD_CDC 0
+#endif
+#ifndef CFG_TUD_MSC
+#define CFG_TUD_MSC 0
+#endif
+#ifndef CFG_TUD_HID
+#define CFG_TUD_HID 0
+#endif
+#ifndef CFG_TUD_MIDI
+#define CFG_TUD_MIDI 0
+#endif
+#ifndef CFG_TUD_VENDOR
+#define CFG_TUD_VENDOR 0
+#endif
+#ifndef CFG_TUD_ECM_RNDIS
+#define CFG_TUD_ECM_RNDIS 0
+#endif
+#ifndef CFG_TUD_NCM
+#define CFG_TUD_NCM 0
+#endif
+#ifndef CFG_TUD_NET_MTU
+#define CFG_TUD_NET_MTU 1514
+#endif
+#ifndef CFG_TUD_NET_ENDPOINT_SIZE
+#define CFG_TUD_NET_ENDPOINT_SIZE 64
+#endif
+#ifndef CFG_TUD_HID_EP_BUFSIZE
+#define CFG_TUD_HID_EP_BUFSIZE 64
+#endif
+#ifndef CFG_TUD_ENDPOINT0_SIZE
+#define CFG_TUD_ENDPOINT0_SIZE 64
+#endif
+#ifndef CFG_TUH_DEVICE_MAX
+#define CFG_TUH_DEVICE_MAX 1
+#endif
+#ifndef CFG_TUH_HID
+#define CFG_TUH_HID 0
+#endif
+
+#endif
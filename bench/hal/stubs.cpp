@@ -0,0 +1,76 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+// Everything else the firmware links against that the bench has no use for: the libraries web
+// config and console auth pull in, and the symbols the RP2040 linker script would provide.
+
+#include "pico.h"
+#include "mbedtls/rsa.h"
+#include "mbedtls/sha256.h"
+#include "class/net/net_device.h"
+
+#include "rndis.h"
+
+// Console auth never gets a challenge, so signing just has to fail cleanly
+void mbedtls_rsa_init(mbedtls_rsa_context *ctx, int padding, int hash_id) {
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->padding = padding;
+    ctx->hash_id = hash_id;
+}
+
+int mbedtls_rsa_import(mbedtls_rsa_context *ctx, const mbedtls_mpi *N, const mbedtls_mpi *P, const mbedtls_mpi *Q, const mbedtls_mpi *D, const mbedtls_mpi *E) {
+    (void)ctx; (void)N; (void)P; (void)Q; (void)D; (void)E;
+    return -1;
+}
+
+int mbedtls_rsa_complete(mbedtls_rsa_context *ctx) {
+    (void)ctx;
+    return -1;
+}
+
+int mbedtls_rsa_export_raw(const mbedtls_rsa_context *ctx,
+                           unsigned char *N, size_t N_len,
+                           unsigned char *P, size_t P_len,
+                           unsigned char *Q, size_t Q_len,
+                           unsigned char *D, size_t D_len,
+                           unsigned char *E, size_t E_len) {
+    (void)ctx; (void)N; (void)N_len; (void)P; (void)P_len; (void)Q; (void)Q_len;
+    (void)D; (void)D_len; (void)E; (void)E_len;
+    return -1;
+}
+
+int mbedtls_rsa_rsassa_pss_sign(mbedtls_rsa_context *ctx,
+                                int (*f_rng)(void *, unsigned char *, size_t), void *p_rng,
+                                int mode, mbedtls_md_type_t md_alg, unsigned int hashlen,
+                                const unsigned char *hash, unsigned char *sig) {
+    (void)ctx; (void)f_rng; (void)p_rng; (void)mode; (void)md_alg; (void)hashlen; (void)hash; (void)sig;
+    return -1;
+}
+
+void mbedtls_rsa_free(mbedtls_rsa_context *ctx) {
+    (void)ctx;
+}
+
+int mbedtls_sha256_ret(const unsigned char *input, size_t ilen, unsigned char output[32], int is224) {
+    (void)input; (void)ilen; (void)is224;
+    memset(output, 0, 32);
+    return -1;
+}
+
+// Web config's network interface, which lib/rndis would bring up
+uint8_t tud_network_mac_address[6] = {0x02, 0x02, 0x84, 0x6A, 0x96, 0x00};
+
+int rndis_init(void) {
+    return 0;
+}
+
+void rndis_task(void) {}
+
+// The linker script's section boundaries, only read for the memory figures in web config
+char __flash_binary_start;
+char __flash_binary_end;
+char __bss_end__;
+char __StackLimit;
+char __StackTop;
@@ -0,0 +1,332 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+// Host definitions for the TinyUSB stand-in in bench/hal/include.
+//
+// tud_init() enumerates straight away: the input driver's configuration descriptor is walked and each
+// interface offered to its class driver, the way TinyUSB does on SET_CONFIGURATION, so the driver
+// opens its endpoints and is mounted. An IN transfer is counted and folded into a CRC32 when it's
+// queued, then completes on the next tud_task() through the class driver's xfer_cb. OUT transfers
+// never complete, since no host ever sends anything. The host stack never sees a device attach.
+
+#include "benchhal.h"
+
+#include "tusb.h"
+#include "device/usbd_pvt.h"
+#include "host/usbh_pvt.h"
+#include "class/net/net_device.h"
+
+#include "CRC32.h"
+
+typedef struct {
+    bool opened;
+    bool busy;
+    uint16_t len;
+} bench_endpoint_t;
+
+static bench_endpoint_t endpoints[16][2];
+static const usbd_class_driver_t *classDriver = nullptr;
+static bool mounted = false;
+
+static uint32_t reportCount = 0;
+static CRC32 reportCrc;
+
+static bench_endpoint_t *getEndpoint(uint8_t ep_addr) {
+    return &endpoints[tu_edpt_number(ep_addr) & 0x0f][tu_edpt_dir(ep_addr)];
+}
+
+uint32_t benchReportCount() {
+    return reportCount;
+}
+
+uint32_t benchReportCrc() {
+    return reportCrc.finalize();
+}
+
+//--------------------------------------------------------------------+
+// Device stack
+//--------------------------------------------------------------------+
+bool tud_init(uint8_t rhport) {
+    memset(endpoints, 0, sizeof(endpoints));
+
+    uint8_t driverCount = 0;
+    classDriver = usbd_app_driver_get_cb(&driverCount);
+    if (driverCount == 0 || classDriver == nullptr)
+        return false;
+    classDriver->init();
+    classDriver->reset(rhport);
+
+    uint8_t const *desc = tud_descriptor_configuration_cb(0);
+    if (desc == nullptr)
+        return false;
+    tusb_desc_configuration_t const *config = (tusb_desc_configuration_t const *)desc;
+    uint8_t const *end = desc + config->wTotalLength;
+    uint8_t const *p = tu_desc_next(desc);
+    while (p < end) {
+        if (tu_desc_type(p) == TUSB_DESC_INTERFACE) {
+            uint16_t len = classDriver->open(rhport, (tusb_desc_interface_t const *)p, (uint16_t)(end - p));
+            if (len > 0) {
+                p += len;
+                continue;
+            }
+        }
+        p = tu_desc_next(p);
+    }
+
+    mounted = true;
+    tud_mount_cb();
+    return true;
+}
+
+// Completes every IN transfer queued since the last call, as if the host had polled for it
+void tud_task(void) {
+    for (uint8_t num = 0; num < 16; num++) {
+        bench_endpoint_t *ep = &endpoints[num][TUSB_DIR_IN];
+        if (ep->busy) {
+            ep->busy = false;
+            if (classDriver && classDriver->xfer_cb)
+                classDriver->xfer_cb(0, tu_edpt_addr(num, TUSB_DIR_IN), XFER_RESULT_SUCCESS, ep->len);
+        }
+    }
+}
+
+bool tud_mounted(void) { return mounted; }
+bool tud_ready(void) { return mounted; }
+bool tud_suspended(void) { return false; }
+bool tud_connected(void) { return mounted; }
+bool tud_remote_wakeup(void) { return false; }
+bool tud_disconnect(void) { return true; }
+bool tud_connect(void) { return true; }
+
+// No host ever sends a control request, so anything answering one has nowhere to go
+bool tud_control_xfer(uint8_t rhport, tusb_control_request_t const *request, void *buffer, uint16_t len) {
+    (void)rhport; (void)request; (void)buffer; (void)len;
+    return true;
+}
+
+bool tud_control_status(uint8_t rhport, tusb_control_request_t const *request) {
+    (void)rhport; (void)request;
+    return true;
+}
+
+// Weak like TinyUSB's own, for the drivers that don't bother with them
+TU_ATTR_WEAK void tud_mount_cb(void) {}
+TU_ATTR_WEAK void tud_hid_report_complete_cb(uint8_t instance, uint8_t const *report, uint16_t len) {
+    (void)instance; (void)report; (void)len;
+}
+
+//--------------------------------------------------------------------+
+// usbd_pvt.h
+//--------------------------------------------------------------------+
+bool usbd_open_edpt_pair(uint8_t rhport, uint8_t const *p_desc, uint8_t ep_count, uint8_t xfer_type, uint8_t *ep_out, uint8_t *ep_in) {
+    for (uint8_t i = 0; i < ep_count; i++) {
+        tusb_desc_endpoint_t const *desc_ep = (tusb_desc_endpoint_t const *)p_desc;
+        TU_VERIFY(desc_ep->bDescriptorType == TUSB_DESC_ENDPOINT && desc_ep->bmAttributes.xfer == xfer_type);
+        TU_VERIFY(usbd_edpt_open(rhport, desc_ep));
+        if (tu_edpt_dir(desc_ep->bEndpointAddress) == TUSB_DIR_IN)
+            *ep_in = desc_ep->bEndpointAddress;
+        else
+            *ep_out = desc_ep->bEndpointAddress;
+        p_desc = tu_desc_next(p_desc);
+    }
+    return true;
+}
+
+bool usbd_edpt_open(uint8_t rhport, tusb_desc_endpoint_t const *desc_ep) {
+    (void)rhport;
+    bench_endpoint_t *ep = getEndpoint(desc_ep->bEndpointAddress);
+    ep->opened = true;
+    ep->busy = false;
+    return true;
+}
+
+bool usbd_edpt_claim(uint8_t rhport, uint8_t ep_addr) {
+    (void)rhport;
+    return !getEndpoint(ep_addr)->busy;
+}
+
+bool usbd_edpt_release(uint8_t rhport, uint8_t ep_addr) {
+    (void)rhport; (void)ep_addr;
+    return true;
+}
+
+bool usbd_edpt_xfer(uint8_t rhport, uint8_t ep_addr, uint8_t *buffer, uint16_t total_bytes) {
+    (void)rhport;
+    bench_endpoint_t *ep = getEndpoint(ep_addr);
+    TU_VERIFY(ep->opened && !ep->busy);
+    ep->busy = true;
+    ep->len = total_bytes;
+    if (tu_edpt_dir(ep_addr) == TUSB_DIR_IN) {
+        reportCount++;
+        reportCrc.update(ep_addr);
+        if (buffer != nullptr)
+            reportCrc.update(buffer, total_bytes);
+    }
+    return true;
+}
+
+bool usbd_edpt_busy(uint8_t rhport, uint8_t ep_addr) {
+    (void)rhport;
+    return getEndpoint(ep_addr)->busy;
+}
+
+void usbd_edpt_stall(uint8_t rhport, uint8_t ep_addr) {
+    (void)rhport; (void)ep_addr;
+}
+
+//--------------------------------------------------------------------+
+// HID device class, the part of TinyUSB's hid_device.c the drivers use
+//--------------------------------------------------------------------+
+typedef struct {
+    bool opened;
+    uint8_t ep_in;
+    uint8_t ep_out;
+    uint8_t epin_buf[CFG_TUD_HID_EP_BUFSIZE];
+} bench_hidd_interface_t;
+
+static bench_hidd_interface_t hidInterfaces[CFG_TUD_HID];
+
+void hidd_init(void) {
+    hidd_reset(0);
+}
+
+void hidd_reset(uint8_t rhport) {
+    (void)rhport;
+    memset(hidInterfaces, 0, sizeof(hidInterfaces));
+}
+
+uint16_t hidd_open(uint8_t rhport, tusb_desc_interface_t const *itf_desc, uint16_t max_len) {
+    TU_VERIFY(itf_desc->bInterfaceClass == TUSB_CLASS_HID, 0);
+
+    uint16_t const drv_len = (uint16_t)(sizeof(tusb_desc_interface_t) + 9 + itf_desc->bNumEndpoints * sizeof(tusb_desc_endpoint_t));
+    TU_VERIFY(max_len >= drv_len, 0);
+
+    bench_hidd_interface_t *hid = nullptr;
+    for (uint8_t i = 0; i < CFG_TUD_HID; i++) {
+        if (!hidInterfaces[i].opened) {
+            hid = &hidInterfaces[i];
+            break;
+        }
+    }
+    TU_VERIFY(hid != nullptr, 0);
+
+    // Interface, then the HID descriptor, then the endpoints
+    uint8_t const *p_desc = tu_desc_next(tu_desc_next(itf_desc));
+    TU_VERIFY(usbd_open_edpt_pair(rhport, p_desc, itf_desc->bNumEndpoints, TUSB_XFER_INTERRUPT, &hid->ep_out, &hid->ep_in), 0);
+    hid->opened = true;
+    return drv_len;
+}
+
+bool hidd_control_xfer_cb(uint8_t rhport, uint8_t stage, tusb_control_request_t const *request) {
+    (void)rhport; (void)stage; (void)request;
+    return false;
+}
+
+bool hidd_xfer_cb(uint8_t rhport, uint8_t ep_addr, xfer_result_t result, uint32_t xferred_bytes) {
+    (void)rhport; (void)result;
+    for (uint8_t instance = 0; instance < CFG_TUD_HID; instance++) {
+        bench_hidd_interface_t *hid = &hidInterfaces[instance];
+        if (hid->opened && ep_addr == hid->ep_in) {
+            tud_hid_report_complete_cb(instance, hid->epin_buf, (uint16_t)xferred_bytes);
+            return true;
+        }
+    }
+    return true;
+}
+
+bool tud_hid_n_ready(uint8_t instance) {
+    TU_VERIFY(instance < CFG_TUD_HID && hidInterfaces[instance].opened);
+    return tud_ready() && hidInterfaces[instance].ep_in != 0 && !usbd_edpt_busy(0, hidInterfaces[instance].ep_in);
+}
+
+bool tud_hid_n_report(uint8_t instance, uint8_t report_id, void const *report, uint16_t len) {
+    TU_VERIFY(tud_hid_n_ready(instance));
+    bench_hidd_interface_t *hid = &hidInterfaces[instance];
+
+    if (report_id) {
+        len = TU_MIN(len, CFG_TUD_HID_EP_BUFSIZE - 1);
+        hid->epin_buf[0] = report_id;
+        memcpy(hid->epin_buf + 1, report, len);
+        len++;
+    } else {
+        len = TU_MIN(len, CFG_TUD_HID_EP_BUFSIZE);
+        memcpy(hid->epin_buf, report, len);
+    }
+    return usbd_edpt_xfer(0, hid->ep_in, hid->epin_buf, len);
+}
+
+//--------------------------------------------------------------------+
+// Network device class, only web config uses it and the bench doesn't run that
+//--------------------------------------------------------------------+
+void netd_init(void) {}
+void netd_reset(uint8_t rhport) { (void)rhport; }
+
+uint16_t netd_open(uint8_t rhport, tusb_desc_interface_t const *itf_desc, uint16_t max_len) {
+    (void)rhport; (void)itf_desc; (void)max_len;
+    return 0;
+}
+
+bool netd_control_xfer_cb(uint8_t rhport, uint8_t stage, tusb_control_request_t const *request) {
+    (void)rhport; (void)stage; (void)request;
+    return false;
+}
+
+bool netd_xfer_cb(uint8_t rhport, uint8_t ep_addr, xfer_result_t result, uint32_t xferred_bytes) {
+    (void)rhport; (void)ep_addr; (void)result; (void)xferred_bytes;
+    return true;
+}
+
+bool tud_network_can_xmit(uint16_t size) { (void)size; return false; }
+void tud_network_xmit(void *ref, uint16_t arg) { (void)ref; (void)arg; }
+void tud_network_recv_renew(void) {}
+
+//--------------------------------------------------------------------+
+// Host stack, nothing is ever plugged in
+//--------------------------------------------------------------------+
+bool tuh_init(uint8_t rhport) { (void)rhport; return true; }
+bool tuh_deinit(uint8_t rhport) { (void)rhport; return true; }
+bool tuh_configure(uint8_t rhport, uint32_t cfg_id, const void *cfg_param) { (void)rhport; (void)cfg_id; (void)cfg_param; return true; }
+void tuh_task(void) {}
+bool tuh_inited(void) { return true; }
+bool tuh_mounted(uint8_t daddr) { (void)daddr; return false; }
+bool tuh_ready(uint8_t daddr) { (void)daddr; return false; }
+bool tuh_vid_pid_get(uint8_t daddr, uint16_t *vid, uint16_t *pid) { (void)daddr; (void)vid; (void)pid; return false; }
+bool tuh_control_xfer(tuh_xfer_t *xfer) { (void)xfer; return false; }
+bool tuh_edpt_open(uint8_t daddr, tusb_desc_endpoint_t const *desc_ep) { (void)daddr; (void)desc_ep; return false; }
+
+xfer_result_t tuh_descriptor_get_string_sync(uint8_t daddr, uint8_t index, uint16_t language_id, void *buffer, uint16_t len) {
+    (void)daddr; (void)index; (void)language_id; (void)buffer; (void)len;
+    return XFER_RESULT_FAILED;
+}
+
+uint8_t tuh_hid_itf_get_count(uint8_t dev_addr) { (void)dev_addr; return 0; }
+bool tuh_hid_mounted(uint8_t dev_addr, uint8_t idx) { (void)dev_addr; (void)idx; return false; }
+uint8_t tuh_hid_interface_protocol(uint8_t dev_addr, uint8_t idx) { (void)dev_addr; (void)idx; return HID_ITF_PROTOCOL_NONE; }
+
+uint8_t tuh_hid_parse_report_descriptor(tuh_hid_report_info_t *reports_info_arr, uint8_t arr_count, uint8_t const *desc_report, uint16_t desc_len) {
+    (void)reports_info_arr; (void)arr_count; (void)desc_report; (void)desc_len;
+    return 0;
+}
+
+bool tuh_hid_receive_report(uint8_t dev_addr, uint8_t idx) { (void)dev_addr; (void)idx; return false; }
+
+bool tuh_hid_set_report(uint8_t dev_addr, uint8_t idx, uint8_t report_id, uint8_t report_type, void *report, uint16_t len) {
+    (void)dev_addr; (void)idx; (void)report_id; (void)report_type; (void)report; (void)len;
+    return false;
+}
+
+bool tuh_hid_get_report(uint8_t dev_addr, uint8_t idx, uint8_t report_id, uint8_t report_type, void *report, uint16_t len) {
+    (void)dev_addr; (void)idx; (void)report_id; (void)report_type; (void)report; (void)len;
+    return false;
+}
+
+void usbh_driver_set_config_complete(uint8_t dev_addr, uint8_t itf_num) { (void)dev_addr; (void)itf_num; }
+bool usbh_edpt_claim(uint8_t dev_addr, uint8_t ep_addr) { (void)dev_addr; (void)ep_addr; return false; }
+bool usbh_edpt_release(uint8_t dev_addr, uint8_t ep_addr) { (void)dev_addr; (void)ep_addr; return false; }
+bool usbh_edpt_xfer(uint8_t dev_addr, uint8_t ep_addr, uint8_t *buffer, uint16_t total_bytes) {
+    (void)dev_addr; (void)ep_addr; (void)buffer; (void)total_bytes;
+    return false;
+}
+bool usbh_edpt_busy(uint8_t dev_addr, uint8_t ep_addr) { (void)dev_addr; (void)ep_addr; return false; }
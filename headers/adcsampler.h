@@ -0,0 +1,64 @@
+#ifndef _ADCSAMPLER_H_
+#define _ADCSAMPLER_H_
+
+#include <stdint.h>
+
+#include "pico/stdlib.h"
+#include "types.h"
+
+#define ADC_SAMPLER_PIN_OFFSET 26
+#define ADC_SAMPLER_CHANNELS 4
+
+// Samples kept per channel, the value handed out is their average. Must be a power of two.
+#ifndef ADC_SAMPLER_OVERSAMPLE
+#define ADC_SAMPLER_OVERSAMPLE 16
+#endif
+
+// Conversions per second across all channels. 50 kS/s with four channels refreshes the whole
+// window about every 1.3 ms.
+#ifndef ADC_SAMPLER_RATE
+#define ADC_SAMPLER_RATE 50000
+#endif
+
+/**
+ * @brief Runs the ADC in the background for every add-on that needs an analog pin.
+ *
+ * The ADC free-runs in round-robin over the registered channels and a DMA channel streams the
+ * conversions into a ring that holds the last ADC_SAMPLER_OVERSAMPLE samples of each channel. A
+ * second DMA channel re-arms the first each time it reaches the end of the ring, so sampling never
+ * stops and the CPU never waits on a conversion. read() averages a channel's slots in the ring.
+ */
+class ADCSampler {
+public:
+    ADCSampler(ADCSampler const&) = delete;
+    void operator=(ADCSampler const&)  = delete;
+    static ADCSampler& getInstance() {
+        static ADCSampler instance;
+        return instance;
+    }
+
+    // Start sampling pin (26-29) along with any already added, call from setup()
+    bool addPin(Pin_t pin);
+
+    // Latest oversampled value, 12-bit like adc_read()
+    uint16_t read(Pin_t pin);
+
+    static bool isADCPin(Pin_t pin) { return (pin >= ADC_SAMPLER_PIN_OFFSET) && (pin < (ADC_SAMPLER_PIN_OFFSET + ADC_SAMPLER_CHANNELS)); }
+private:
+    ADCSampler() {}
+
+    void start();
+    void stop();
+
+    uint8_t channelMask = 0;
+    uint8_t channelCount = 0;
+    uint8_t channelSlot[ADC_SAMPLER_CHANNELS]; // position of each channel within a round-robin pass
+    int dataChannel = -1;
+    int controlChannel = -1;
+    absolute_time_t readyAt;
+
+    uint16_t ring[ADC_SAMPLER_CHANNELS * ADC_SAMPLER_OVERSAMPLE];
+    uint16_t *ringStart = ring; // read by the control channel
+};
+
+#endif
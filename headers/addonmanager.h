@@ -15,6 +15,7 @@ enum ADDON_PROCESS {
 struct AddonBlock {
     GPAddon * ptr;
     ADDON_PROCESS process;
+    uint8_t perfStage;  // first of its preprocess/process/postprocess PerfStats stages
 };
 
 class AddonManager {
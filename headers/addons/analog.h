@@ -104,28 +104,28 @@
 
 #define ADC_COUNT 2
 
+// Stick positions are fixed point with 24 fractional bits, 0 is fully one way and
+// ANALOG_MAX (1.0) fully the other
 typedef struct
 {
     Pin_t x_pin;
     Pin_t y_pin;
-    Pin_t x_pin_adc;
-    Pin_t y_pin_adc;
-    float x_value;
-    float y_value;
+    int32_t x_value;
+    int32_t y_value;
     uint16_t x_center;
     uint16_t y_center;
-    float xy_magnitude;
-    float x_magnitude;
-    float y_magnitude;
+    int32_t xy_magnitude;    // distance from center, scaled by error_rate
+    int32_t x_magnitude;     // offset from center
+    int32_t y_magnitude;
     InvertMode analog_invert;
     DpadMode analog_dpad;
-    float x_ema;
-    float y_ema;
+    int32_t x_ema;
+    int32_t y_ema;
     bool ema_option;
-    float ema_smoothing;
-    float error_rate;
-    float in_deadzone;
-    float out_deadzone;
+    int32_t ema_smoothing;   // 16 fractional bits
+    uint32_t error_rate;     // per mille
+    int32_t in_deadzone;
+    int32_t out_deadzone;
     bool auto_calibration;
     bool forced_circularity;
 } adc_instance;
@@ -140,10 +140,11 @@ public:
     virtual void reinit() {}
     virtual std::string name() { return AnalogName; }
 private:
-    float readPin(int stick_num, Pin_t pin, uint16_t center);
-    float emaCalculation(int stick_num, float ema_value, float ema_previous);
+    int32_t readPin(int stick_num, Pin_t pin, uint16_t center);
+    int32_t emaCalculation(int stick_num, int32_t ema_value, int32_t ema_previous);
     uint16_t map(uint16_t x, uint16_t in_min, uint16_t in_max, uint16_t out_min, uint16_t out_max);
-    float magnitudeCalculation(int stick_num, adc_instance & adc_inst);
+    int32_t magnitudeCalculation(int stick_num, adc_instance & adc_inst);
+    uint16_t toJoystick(int32_t value, bool roundUp);
     void radialDeadzone(int stick_num, adc_instance & adc_inst);
     adc_instance adc_pairs[ADC_COUNT];
 };
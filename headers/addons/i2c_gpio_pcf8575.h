@@ -8,8 +8,6 @@
 #include "GamepadEnums.h"
 #include "peripheralmanager.h"
 
-#include <map>
-
 #ifndef I2C_PCF8575_ENABLED
 #define I2C_PCF8575_ENABLED 0
 #endif
@@ -18,6 +16,11 @@
 #define I2C_PCF8575_BLOCK i2c0
 #endif
 
+// GPIO wired to the expander's INT output, -1 to read it every loop
+#ifndef I2C_PCF8575_INTERRUPT_PIN
+#define I2C_PCF8575_INTERRUPT_PIN -1
+#endif
+
 #define PCF8575_PIN_COUNT 16
 
 // IO pin defaults
@@ -146,29 +149,23 @@ public:
     virtual void reinit() {}
     virtual std::string name() { return PCF8575AddonName; }
 
-    std::map<uint8_t, GpioMappingInfo> pinRef;
 private:
+    void updateInputs(uint16_t pins);
+
     PCF8575* pcf;
 
-    bool inputButtonUp = false;
-    bool inputButtonDown = false;
-    bool inputButtonLeft = false;
-    bool inputButtonRight = false;
-    bool inputButtonB1 = false;
-    bool inputButtonB2 = false;
-    bool inputButtonB3 = false;
-    bool inputButtonB4 = false;
-    bool inputButtonL1 = false;
-    bool inputButtonR1 = false;
-    bool inputButtonL2 = false;
-    bool inputButtonR2 = false;
-    bool inputButtonS1 = false;
-    bool inputButtonS2 = false;
-    bool inputButtonL3 = false;
-    bool inputButtonR3 = false;
-    bool inputButtonA1 = false;
-    bool inputButtonA2 = false;
-    bool inputButtonFN = false;
+    int32_t interruptPin = -1;
+
+    // what each expander pin does, flattened out of the pin actions in setup()
+    uint8_t pinDpad[PCF8575_PIN_COUNT] = {};
+    uint32_t pinButtons[PCF8575_PIN_COUNT] = {};
+    uint16_t inputMask = 0;
+    uint16_t outputMask = 0;
+
+    // held inputs as of the last read that changed anything
+    uint16_t lastPins = 0xFFFF;
+    uint8_t inputDpad = 0;
+    uint32_t inputButtons = 0;
 };
 
 #endif  // _I2CAnalog_H_
@@ -33,6 +33,8 @@ public:// USB Listener Features
     virtual void report_sent(uint8_t dev_addr, uint8_t instance, uint8_t const* report, uint16_t len) {}
     virtual void set_report_complete(uint8_t dev_addr, uint8_t instance, uint8_t report_id, uint8_t report_type, uint16_t len) {}
     virtual void get_report_complete(uint8_t dev_addr, uint8_t instance, uint8_t report_id, uint8_t report_type, uint16_t len) {}
+    virtual bool wantsReports(uint8_t dev_addr, uint8_t instance);
+    virtual bool latestReportOnly(uint8_t dev_addr, uint8_t instance);
     void process();
 private:
     uint8_t getKeycodeFromModifier(uint8_t modifier);
@@ -113,6 +113,8 @@ public:
         uint32_t updateTime = 0;
         uint32_t changeTime = 0;
         uint8_t delay = 1;
+        int stateMachine = -1;  // PIO1 state machine counting the edges, -1 when polled
+        int32_t count = 0;      // its count as of the last process()
     } EncoderPinState;
 private:
     EncoderPinState encoderState[MAX_ENCODERS];
@@ -130,6 +132,9 @@ private:
     int8_t mapEncoderValueDPad(int8_t index, int32_t encoderValue, uint16_t ppr);
 
     int8_t getEncoderIndexByPin(uint8_t pin);
+    void setupCounter(uint8_t index);
+
+    int counterOffset = -1;
     
     bool dpadUp = false;
     bool dpadDown = false;
@@ -89,8 +89,11 @@ public:
     virtual std::string name() { return WiiExtensionName; }
 private:
     WiiExtensionDevice * wii;
-    uint32_t uIntervalMS;
-    uint32_t nextTimer;
+
+    // What process() merges into the gamepad, rebuilt by update() from each new report. Only the
+    // dpad, buttons and the sticks and triggers flagged in mergeAxes are used.
+    GamepadState mergeState;
+    uint16_t mergeAxes = 0; // 1 << WII_ANALOG_TYPE_*
 
     // controller ID = config
     // defaults if no defined config
@@ -378,6 +381,7 @@ private:
     uint16_t bounds(uint16_t x, uint16_t out_min, uint16_t out_max);
 
     void update();
+    void updateMergeState();
     void setControllerButton(uint16_t controllerID, uint16_t buttonID, uint32_t buttonMask);
     void setControllerAnalog(uint16_t controllerID, uint16_t analogID, uint32_t axisType);
     void setControllerStickMode(uint16_t controllerID, uint16_t analogID, uint32_t axisType);
@@ -23,7 +23,7 @@ struct RGB {
     : r(r), g(g), b(b), w(w) { }
 
   RGB(uint32_t c)
-    : r((c >> 16) & 255), g((c >> 8) & 255), b((c >> 0) & 255) { }
+    : r((c >> 16) & 255), g((c >> 8) & 255), b((c >> 0) & 255), w(0) { }
 
   uint8_t r;
   uint8_t g;
@@ -43,44 +43,79 @@ struct RGB {
     }
   }
 
-  inline uint32_t value(LEDFormat format, float brightnessX = 1.0F) const {
+  // Brightness as a Q8 scale factor, 0 (off) to 256 (full)
+  inline static uint16_t scaleOf(float brightnessX) {
+    if (brightnessX <= 0.0f)
+      return 0;
+    if (brightnessX >= 1.0f)
+      return 256;
+    return (uint16_t)(brightnessX * 256.0f + 0.5f);
+  }
+
+  /* The channels packed one per byte (r lowest). Pairs of channels get spread out to
+  0x00XX00YY so a single multiply scales both with room for the 16-bit product. */
+  inline uint32_t packed() const {
+    return (uint32_t)r | ((uint32_t)g << 8) | ((uint32_t)b << 16) | ((uint32_t)w << 24);
+  }
+
+  inline static RGB unpack(uint32_t c) {
+    return RGB(c & 255, (c >> 8) & 255, (c >> 16) & 255, c >> 24);
+  }
+
+  inline static uint32_t scalePacked(uint32_t c, uint16_t scale) {
+    uint32_t rb = (((c & 0x00FF00FF) * scale) >> 8) & 0x00FF00FF;
+    uint32_t gw = (((c >> 8) & 0x00FF00FF) * scale) & 0xFF00FF00;
+    return rb | gw;
+  }
+
+  // Fade from start to end, progress is Q8 from 0 (all start) to 256 (all end)
+  inline static RGB blend(RGB start, RGB end, uint16_t progress) {
+    uint32_t s = start.packed();
+    uint32_t e = end.packed();
+    uint16_t remaining = 256 - progress;
+    uint32_t rb = ((((s & 0x00FF00FF) * remaining) + ((e & 0x00FF00FF) * progress)) >> 8) & 0x00FF00FF;
+    uint32_t gw = ((((s >> 8) & 0x00FF00FF) * remaining) + (((e >> 8) & 0x00FF00FF) * progress)) & 0xFF00FF00;
+    return unpack(rb | gw);
+  }
+
+  // Color for the LED chain at a Q8 brightness, see scaleOf()
+  inline uint32_t scaledValue(LEDFormat format, uint16_t scale) const {
+    uint32_t c = scalePacked(packed(), scale);
+    uint32_t sr = c & 255;
+    uint32_t sg = (c >> 8) & 255;
+    uint32_t sb = (c >> 16) & 255;
+    uint32_t sw = c >> 24;
     switch (format) {
       case LED_FORMAT_GRB:
-        return ((uint32_t)(g * brightnessX) << 16)
-            | ((uint32_t)(r * brightnessX) << 8)
-            | (uint32_t)(b * brightnessX);
+        return (sg << 16) | (sr << 8) | sb;
 
       case LED_FORMAT_RGB:
-        return ((uint32_t)(r * brightnessX) << 16)
-            | ((uint32_t)(g * brightnessX) << 8)
-            | (uint32_t)(b * brightnessX);
+        return (sr << 16) | (sg << 8) | sb;
 
       case LED_FORMAT_GRBW:
       {
         if ((r == g) && (r == b))
-          return (uint32_t)(r * brightnessX);
+          return sr;
 
-        return ((uint32_t)(g * brightnessX) << 24)
-            | ((uint32_t)(r * brightnessX) << 16)
-            | ((uint32_t)(b * brightnessX) << 8)
-            | (uint32_t)(w * brightnessX);
+        return (sg << 24) | (sr << 16) | (sb << 8) | sw;
       }
 
       case LED_FORMAT_RGBW:
       {
         if ((r == g) && (r == b))
-          return (uint32_t)(r * brightnessX);
+          return sr;
 
-        return ((uint32_t)(r * brightnessX) << 24)
-            | ((uint32_t)(g * brightnessX) << 16)
-            | ((uint32_t)(b * brightnessX) << 8)
-            | (uint32_t)(w * brightnessX);
+        return (sr << 24) | (sg << 16) | (sb << 8) | sw;
       }
     }
 
     assert(false);
     return 0;
   }
+
+  inline uint32_t value(LEDFormat format, float brightnessX = 1.0F) const {
+    return scaledValue(format, scaleOf(brightnessX));
+  }
 };
 
 // Also defined in Enums.proto
@@ -108,20 +143,29 @@ inline const std::vector<RGB> colors {
     ColorViolet
 };
 
+inline bool operator==(const RGB &lhs, const RGB &rhs) {
+  return lhs.r == rhs.r && lhs.g == rhs.g && lhs.b == rhs.b && lhs.w == rhs.w;
+}
+
+inline bool operator!=(const RGB &lhs, const RGB &rhs) {
+  return !(lhs == rhs);
+}
+
 class Animation {
 public:
   Animation(PixelMatrix &matrix);
-  virtual void UpdatePixels(std::vector<Pixel> pixels);
+  virtual void UpdatePixels(uint32_t pressedPixels);
   void ClearPixels();
   virtual ~Animation(){};
 
   static LEDFormat format;
 
-  bool notInFilter(Pixel pixel);
+  bool notInFilter(uint8_t pixel);
   virtual bool Animate(RGB (&frame)[100]) = 0;
   void UpdateTime();
   void UpdatePresses(RGB (&frame)[100]);
-  void DecrementFadeCounter(int32_t index);
+  void DecrementFadeCounter(uint8_t pixel);
+  void SetPixel(RGB (&frame)[100], uint8_t pixel, RGB color);
 
   virtual void ParameterUp() = 0;
   virtual void ParameterDown() = 0;
@@ -134,15 +178,27 @@ public:
 protected:
 /* We track both the full matrix as well as individual pixels here to support
 button press changes. Rather than adjusting the matrix to represent a subset of pixels,
-we provide a subset of pixels to use as a filter. */
+we provide a subset of pixels (one bit per matrix pixel) to use as a filter. */
   PixelMatrix *matrix;
-  std::vector<Pixel> pixels;
+  uint32_t pressedPixels = 0;
   bool filtered = false;
 
-  // Color fade 
+  /* Effects that hold a steady color only need to write a pixel again once something about it
+  changed: it was pressed, it's fading, or the effect's parameters moved. A set bit means the
+  pixel already shows its final color. */
+  uint32_t settledPixels = 0;
+  inline bool isSettled(uint8_t pixel) const { return (settledPixels & (1u << pixel)) && times[pixel] == 0; }
+  // A held pixel is left to the button animation, which paints over it every frame, so it only
+  // settles once it has been released and drawn by this effect again
+  inline void markSettled(uint8_t pixel) {
+    if (times[pixel] == 0 && !(pressedPixels & (1u << pixel)))
+      settledPixels |= (1u << pixel);
+  }
+
+  // Color fade, indexed by matrix pixel
   RGB defaultColor = ColorBlack;  
-  static std::map<uint32_t, int32_t> times;
-  static std::map<uint32_t, RGB> hitColor;    
+  static int32_t times[PIXEL_MATRIX_MAX_PIXELS];
+  static RGB hitColor[PIXEL_MATRIX_MAX_PIXELS];
   absolute_time_t lastUpdateTime = nil_time;
   uint32_t coolDownTimeInMs = 1000;
   int64_t updateTimeInMs = 20;
@@ -32,10 +32,10 @@ public:
     void ChangeAnimation(int changeSize);
     void ApplyBrightness(uint32_t *frameValue);
     uint16_t AdjustIndex(int changeSize);
-    void HandlePressed(std::vector<Pixel> pressed);
+    void HandlePressed(uint32_t buttonState);
     void ClearPressed();
     void SetMode(uint8_t mode);
-    void SetMatrix(PixelMatrix matrix);
+    void SetMatrix(const PixelMatrix & matrix);
     void ConfigureBrightness(uint8_t max, uint8_t steps);
     float GetBrightnessX();
     float GetLinkageModeOfBrightnessX();
@@ -51,10 +51,15 @@ public:
 private:
     Animation* baseAnimation;
     Animation* buttonAnimation;
-    std::vector<Pixel> lastPressed;
+    uint32_t pressedPixels = 0;
     absolute_time_t nextChange;
     uint8_t effectCount;
     RGB frame[100];
+    // Last frame that went through ApplyBrightness, only LEDs that changed since get converted again
+    RGB appliedFrame[100];
+    uint32_t appliedValues[100];
+    uint16_t appliedScale = UINT16_MAX;
+    LEDFormat appliedFormat;
     bool ambientLightEffectsChangeFlag = false; 
     bool ambientLightOnOffFlag = false;
     bool ambientLightLinkageOnOffFlag = false;
@@ -16,6 +16,8 @@ public:
   void ParameterDown();
 protected:
   std::map<uint32_t, RGB> theme;
+  uint32_t themedPixels = 0;
+  RGB pixelColors[PIXEL_MATRIX_MAX_PIXELS];
 };
 
 #endif
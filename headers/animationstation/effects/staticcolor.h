@@ -10,7 +10,7 @@
 class StaticColor : public Animation {
 public:
   StaticColor(PixelMatrix &matrix);
-  StaticColor(PixelMatrix &matrix, std::vector<Pixel> &pixels);
+  StaticColor(PixelMatrix &matrix, uint32_t pressedPixels);
   ~StaticColor() { };
 
   bool Animate(RGB (&frame)[100]);
@@ -19,6 +19,7 @@ public:
   void ParameterUp();
   void ParameterDown();
 protected:
+  RGB lastColor = ColorBlack;
 };
 
 #endif
@@ -21,8 +21,13 @@ public:
   void ParameterUp();
   void ParameterDown();
 protected:
+  void ApplyTheme(uint32_t themeIndex);
+
   RGB defaultColor = ColorBlack;
   std::vector<std::map<uint32_t, RGB>> themes;
+  uint32_t appliedThemeIndex = UINT32_MAX;
+  uint32_t themedPixels = 0;
+  RGB pixelColors[PIXEL_MATRIX_MAX_PIXELS];
 };
 
 #endif
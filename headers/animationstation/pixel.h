@@ -6,6 +6,10 @@
 #include <stdlib.h>
 #include <vector>
 
+// Pressed and settled pixels are tracked as bits in a uint32_t
+#define PIXEL_MATRIX_MAX_PIXELS 32
+#define PIXEL_MATRIX_MAX_POSITIONS 100
+
 struct Pixel {
   Pixel(int index, uint32_t mask = 0) : index(index), mask(mask) { }
   Pixel(int index, std::vector<uint8_t> positions) : index(index), positions(positions) { }
@@ -18,36 +22,62 @@ struct Pixel {
 
 inline const Pixel NO_PIXEL(-1);
 
+/* Layouts are described as rows of Pixels, which is easy to write but means a heap allocation per
+pixel and a pointer chase per LED. setup() flattens that once into fixed tables: pixel i has button
+mask masks[i] and lights positions[offsets[i]] up to (not including) positions[offsets[i + 1]].
+NO_PIXEL gaps are dropped. */
 struct PixelMatrix {
   PixelMatrix() { }
 
-  std::vector<std::vector<Pixel>> pixels;
-  uint8_t ledsPerPixel;
-  void setup(std::vector<std::vector<Pixel>> pixels, int ledsPerPixel = -1) {
-    this->pixels = pixels;
-    this->ledsPerPixel = ledsPerPixel;
-  }
+  uint8_t pixelCount = 0;   // pixels in the tables
+  uint8_t slotCount = 0;    // layout slots, gaps included
+  uint8_t ledsPerPixel = 0;
+  int16_t indexes[PIXEL_MATRIX_MAX_PIXELS];
+  uint32_t masks[PIXEL_MATRIX_MAX_PIXELS];
+  uint8_t offsets[PIXEL_MATRIX_MAX_PIXELS + 1] = { 0 };
+  uint8_t positions[PIXEL_MATRIX_MAX_POSITIONS];
 
-  inline int getLedCount() {
-    int count = 0;
-    for (auto &col : pixels)
-      for (auto &pixel : col)
-        if (pixel.index == NO_PIXEL.index)
+  void setup(const std::vector<std::vector<Pixel>> &pixels, int ledsPerPixel = -1) {
+    this->ledsPerPixel = ledsPerPixel;
+    pixelCount = 0;
+    slotCount = 0;
+    uint8_t positionCount = 0;
+    for (auto &col : pixels) {
+      for (auto &pixel : col) {
+        slotCount++;
+        if (pixel.index == NO_PIXEL.index || pixelCount == PIXEL_MATRIX_MAX_PIXELS)
           continue;
-        else
-          count += pixel.positions.size();
 
-    return count;
+        indexes[pixelCount] = pixel.index;
+        masks[pixelCount] = pixel.mask;
+        offsets[pixelCount] = positionCount;
+        for (auto &pos : pixel.positions) {
+          if (positionCount < PIXEL_MATRIX_MAX_POSITIONS)
+            positions[positionCount++] = pos;
+        }
+        pixelCount++;
+      }
+    }
+    offsets[pixelCount] = positionCount;
   }
 
-  inline uint16_t getPixelCount() const {
-    uint16_t count = 0;
-    for (auto &col : pixels)
-      count += col.size();
+  inline int getLedCount() const {
+    return offsets[pixelCount];
+  }
 
-    return count;
+  inline uint16_t getPixelCount() const {
+    return slotCount;
   }
 
+  // One bit per pixel whose button is held in buttonState
+  inline uint32_t getPressedPixels(uint32_t buttonState) const {
+    uint32_t pressed = 0;
+    for (uint8_t i = 0; i < pixelCount; i++) {
+      if (buttonState & masks[i])
+        pressed |= (1u << i);
+    }
+    return pressed;
+  }
 };
 
 inline bool operator==(const Pixel &lhs, const Pixel &rhs) {
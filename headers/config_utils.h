@@ -2,16 +2,43 @@
 #define CONFIG_UTILS_H
 
 #include "config.pb.h"
+#include "CRC32.h"
 #include <string>
 
 namespace ConfigUtils {
-    void load(Config& config);
+    // Receives output piece by piece as toJSON()/toProtobuf() generate it. Setting finished stops
+    // them from generating anything further.
+    class StreamWriter {
+    public:
+        virtual void write(const char* data, size_t length) = 0;
+        bool finished = false;
+    };
+
+    // How far the piecewise toJSON()/toProtobuf() have got. The output is split at its top-level
+    // fields: each call regenerates the part position is on and only moves on once the writer has
+    // taken all of it, so it can be sent a window at a time without ever being held as a whole.
+    struct StreamPosition {
+        uint32_t part = 0;
+        CRC32 crc; // of the parts already done, for toProtobuf()'s trailer
+    };
+
+    bool load(Config& config); // returns true if the loaded config still needs to be saved
     bool save(Config& config);
     
     void initUnsetPropertiesWithDefaults(Config& config);
 
     std::string toJSON(const Config& config);
+    void toJSON(const Config& config, StreamWriter& writer);
+    bool toJSON(const Config& config, StreamPosition& position, StreamWriter& writer); // false once every part is done
     bool fromJSON(Config& config, const char* data, size_t dataLen);
+
+    // Encoded Config, or just the top-level message field with the given tag (0 for all of it),
+    // followed by the little-endian CRC32 of the encoded bytes. Fields marked disallow_export are
+    // left out, fromProtobuf() takes them from current instead.
+    bool toProtobuf(const Config& config, uint32_t tag, StreamWriter& writer);
+    bool toProtobuf(const Config& config, uint32_t tag, StreamPosition& position, StreamWriter& writer); // false once every part is done
+    bool fromProtobuf(Config& config, const Config& current, uint32_t tag, const uint8_t* data, size_t dataLen);
+    uint32_t findProtobufSection(const char* name); // tag of the top-level message field, 0 if there is none
     bool fromLegacyStorage(Config& config);
 }
 
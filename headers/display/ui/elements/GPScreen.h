@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <cstring>
+#include <algorithm>
 #include "GPWidget.h"
 
 class GPScreen : public GPWidget {
@@ -16,9 +17,11 @@ class GPScreen : public GPWidget {
         virtual void shutdown() = 0;
     protected:
         virtual void drawScreen() = 0;
+        // Keeps the display list in draw order (highest priority first, then insertion order), so set
+        // the priority before adding the element
         GPWidget * addElement(GPWidget* element) {
-            displayList.push_back(element);
-            element->setID(displayList.size()-1);
+            element->setID(displayList.size());
+            displayList.insert(std::upper_bound(displayList.begin(), displayList.end(), element, prioritySort), element);
             return element;
         }
         void clearElements() {
@@ -28,6 +31,10 @@ class GPScreen : public GPWidget {
             displayList.clear();
         }
     private:
+        static bool prioritySort(GPWidget * a, GPWidget * b) {
+            return a->getPriority() > b->getPriority();
+        }
+
         std::vector<GPWidget*> displayList;
 };
 
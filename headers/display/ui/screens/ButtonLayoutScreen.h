@@ -116,6 +116,7 @@ class ButtonLayoutScreen : public GPScreen {
 
         void handleProfileChange(GPEvent* e);
         void handleUSB(GPEvent* e);
+        void handleStorageCommit(GPEvent* e);
     protected:
         virtual void drawScreen();
     private:
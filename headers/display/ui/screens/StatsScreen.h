@@ -13,7 +13,10 @@ class StatsScreen : public GPScreen {
         virtual void shutdown();
     protected:
         virtual void drawScreen();
+        void drawPerfPage(uint8_t perfPage);
         uint16_t prevButtonState = 0;
+        uint8_t page = 0;           // 0 is the build info, the rest are stage timing
+        uint8_t perfPageCount = 0;
 };
 
 #endif
\ No newline at end of file
@@ -7,26 +7,57 @@
 #include <deque>
 #include <array>
 #include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include <cctype>
 #include "config.pb.h"
 #include "enums.pb.h"
 
+#include "pico/platform.h"
+#include "hardware/sync.h"
+
+#include "perfstats.h"
+
 #include "GPEvent.h"
 #include "GPGamepadEvent.h"
 #include "GPEncoderEvent.h"
 #include "GPMenuNavigateEvent.h"
 #include "GPProfileEvent.h"
 #include "GPRestartEvent.h"
+#include "GPStorageCommitEvent.h"
 #include "GPStorageSaveEvent.h"
 #include "GPSystemRebootEvent.h"
 #include "GPUSBHostEvent.h"
 
 #define EVENTMGR EventManager::getInstance()
 
+// Number of handlers each core can register, across all event types. Running out asserts, so raise
+// this if the add-ons on one core ever need more.
+#define EVENTMGR_MAX_HANDLERS 16
+
+// Events waiting to be handed to the other core, must be a power of two. Events that find the queue
+// full are dropped and counted in PerfStats.
+#define EVENTMGR_QUEUE_SIZE 8
+
+// Largest event that can be queued for the other core
+#define EVENTMGR_MAX_EVENT_SIZE 64
+
+#define EVENTMGR_NO_HANDLER 0xFF
+
+/**
+ * @brief Dispatches GPEvents to registered handlers without touching the heap.
+ *
+ * Events are built on the caller's stack and passed by reference. Handlers live in a fixed pool per core,
+ * chained per event type, so finding the handlers for an event is a single table lookup.
+ *
+ * Handlers run on the core that registered them. Triggering an event runs the current core's handlers
+ * immediately, and copies the event into a single-producer/single-consumer queue for the other core if
+ * it has handlers for that type. Each core drains its queue with processEvents() once per loop.
+ */
 class EventManager {
     public:
         typedef std::function<void(GPEvent* event)> EventFunction;
-        typedef std::pair<GPEventType, std::vector<EventFunction>> EventEntry;
 
         EventManager(EventManager const&) = delete;
         void operator=(EventManager const&)  = delete;
@@ -39,13 +70,73 @@ class EventManager {
         void init();
         void clearEventHandlers();
 
-        void registerEventHandler(GPEventType eventType, EventFunction handler);
+        // Returns false if the type is out of range or this core's handler pool is full
+        bool registerEventHandler(GPEventType eventType, EventFunction handler);
         void unregisterEventHandler(GPEventType eventType, EventFunction handler);
-        void triggerEvent(GPEvent* event);
+
+        template <typename T>
+        void triggerEvent(T&& event) {
+            typedef typename std::decay<T>::type EventType;
+            static_assert(std::is_base_of<GPEvent, EventType>::value, "events must derive from GPEvent");
+            static_assert(sizeof(EventType) <= EVENTMGR_MAX_EVENT_SIZE, "event too large for EVENTMGR_MAX_EVENT_SIZE");
+
+            GPEventType eventType = event.eventType();
+            if (eventType >= _GPEventType_ARRAYSIZE)
+                return;
+
+            uint8_t core = get_core_num();
+            dispatch(core, eventType, &event);
+
+            // hand a copy to the other core, if anything over there cares
+            uint8_t otherCore = core ^ 1;
+            if (cores[otherCore].first[eventType] != EVENTMGR_NO_HANDLER) {
+                EventQueue& queue = cores[otherCore].queue;
+                uint32_t head = queue.head;
+                uint32_t next = (head + 1) & (EVENTMGR_QUEUE_SIZE - 1);
+                if (next == queue.tail) {
+                    PerfStats::getInstance().countDroppedEvent();
+                    return;
+                }
+                new (queue.slots[head].storage) EventType(event);
+                __dmb(); // publish the event before moving head
+                queue.head = next;
+            }
+        }
+
+        // Run handlers for events other core queued for this one
+        void processEvents();
     private:
         EventManager(){}
 
-        std::vector<EventEntry> eventList;
+        struct EventHandler {
+            EventFunction function;
+            uint8_t next;       // next handler for the same event type
+            uint8_t nextFree;   // next unregistered slot
+        };
+
+        struct EventSlot {
+            alignas(8) uint8_t storage[EVENTMGR_MAX_EVENT_SIZE];
+        };
+
+        struct EventQueue {
+            EventSlot slots[EVENTMGR_QUEUE_SIZE];
+            volatile uint32_t head = 0; // written by the other core
+            volatile uint32_t tail = 0; // written by the owning core
+        };
+
+        struct CoreEvents {
+            CoreEvents() { for (auto& f : first) f = EVENTMGR_NO_HANDLER; }
+
+            EventHandler handlers[EVENTMGR_MAX_HANDLERS];
+            uint8_t handlerCount = 0;
+            uint8_t freeList = EVENTMGR_NO_HANDLER;
+            uint8_t first[_GPEventType_ARRAYSIZE];
+            EventQueue queue;
+        };
+
+        void dispatch(uint8_t core, GPEventType eventType, GPEvent* event);
+
+        CoreEvents cores[2];
 };
 
-#endif
\ No newline at end of file
+#endif
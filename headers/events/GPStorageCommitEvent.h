@@ -0,0 +1,25 @@
+#ifndef _GPSTORAGECOMMITEVENT_H_
+#define _GPSTORAGECOMMITEVENT_H_
+
+#include "system.h"
+
+class GPStorageCommitEvent : public GPEvent {
+    public:
+        GPStorageCommitEvent() {}
+        GPStorageCommitEvent(uint32_t done, uint32_t total) {
+            this->stepsDone = done;
+            this->stepsTotal = total;
+        }
+        virtual ~GPStorageCommitEvent() {}
+
+        GPEventType eventType() { return this->_eventType; }
+
+        bool isComplete() const { return stepsDone >= stepsTotal; }
+
+        uint32_t stepsDone = 0;
+        uint32_t stepsTotal = 0;
+    private:
+        GPEventType _eventType = GP_EVENT_STORAGE_COMMIT;
+};
+
+#endif
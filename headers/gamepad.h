@@ -20,13 +20,67 @@ extern uint64_t getMicro();
 
 struct GamepadButtonMapping
 {
+	GamepadButtonMapping() :
+		pinMask(0),
+		buttonMask(0)
+	{}
+
 	GamepadButtonMapping(Mask_t bm) :
 		pinMask(0),
 		buttonMask(bm)
 	{}
 
 	uint32_t pinMask;
-	const uint32_t buttonMask;
+	uint32_t buttonMask;
+};
+
+// Number of GamepadButtonMapping slots owned by a Gamepad (see Gamepad::setup)
+#define GAMEPAD_MAPPING_COUNT 49
+
+// debouncedGpio is translated one nibble at a time
+#define GAMEPAD_LUT_NIBBLES (sizeof(Mask_t) * 2)
+
+// GamepadInputLUTEntry::modes bits, for the mappings that don't land directly in GamepadState
+#define GAMEPAD_LUT_MODE_DP      (1U << 0)
+#define GAMEPAD_LUT_MODE_LS      (1U << 1)
+#define GAMEPAD_LUT_MODE_RS      (1U << 2)
+#define GAMEPAD_LUT_MODE_48WAY   (1U << 3)
+
+// GamepadInputLUTEntry::analog bits
+#define GAMEPAD_LUT_LS_X_NEG     (1U << 0)
+#define GAMEPAD_LUT_LS_X_POS     (1U << 1)
+#define GAMEPAD_LUT_LS_Y_NEG     (1U << 2)
+#define GAMEPAD_LUT_LS_Y_POS     (1U << 3)
+#define GAMEPAD_LUT_RS_X_NEG     (1U << 4)
+#define GAMEPAD_LUT_RS_X_POS     (1U << 5)
+#define GAMEPAD_LUT_RS_Y_NEG     (1U << 6)
+#define GAMEPAD_LUT_RS_Y_POS     (1U << 7)
+
+/**
+ * @brief Everything a group of four GPIO pins contributes to the gamepad state.
+ *
+ * Gamepad::read() ORs one entry per nibble of debouncedGpio together instead of testing every mapping.
+ */
+struct GamepadInputLUTEntry
+{
+	uint32_t buttons;
+	uint16_t aux;
+	uint8_t dpad;
+	uint8_t analog;
+	uint8_t modes;
+};
+
+/**
+ * @brief Storage for the gamepad's button mappings and their GPIO translation tables.
+ *
+ * Allocated once on the first Gamepad::setup() and rebuilt in place on profile changes, so the
+ * mapX pointers handed out to add-ons and the display stay valid across reinit().
+ */
+struct GamepadMappingArena
+{
+	GamepadButtonMapping mappings[GAMEPAD_MAPPING_COUNT];
+	uint8_t count;
+	GamepadInputLUTEntry lut[GAMEPAD_LUT_NIBBLES][16];
 };
 
 class Gamepad {
@@ -207,6 +261,11 @@ public:
 
 private:
 
+	GamepadButtonMapping * addMapping(Mask_t buttonMask);
+	void buildInputLUT();
+
+	GamepadMappingArena * mappingArena = nullptr;
+
 	uint8_t getModifier(uint8_t code);
 	uint8_t getMultimedia(uint8_t code);
 	void processHotkeyAction(GamepadHotkey action);
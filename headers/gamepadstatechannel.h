@@ -0,0 +1,43 @@
+#ifndef _GAMEPADSTATECHANNEL_H_
+#define _GAMEPADSTATECHANNEL_H_
+
+#include <stdint.h>
+
+#include "gamepad/GamepadState.h"
+#include "gamepad/GamepadAuxState.h"
+
+/**
+ * @brief Hands the processed gamepad state from Core0 to Core1.
+ *
+ * A seqlock: Core0 bumps the sequence to an odd value, copies the state in, then bumps it back to
+ * even. Core1 copies the state out and retries if the sequence moved or was odd while it was copying,
+ * so it never sees half of one loop's state and half of another. The writer never waits on the reader.
+ *
+ * State only flows from Core0 to Core1. Core1 must not write to the snapshot it reads into, aux state
+ * included, as the next read replaces all of it.
+ */
+class GamepadStateChannel {
+public:
+    GamepadStateChannel(GamepadStateChannel const&) = delete;
+    void operator=(GamepadStateChannel const&)  = delete;
+    static GamepadStateChannel& getInstance() {
+        static GamepadStateChannel instance;
+        return instance;
+    }
+
+    // Core0: publish a new snapshot and wake Core1
+    void publish(const GamepadState& newState, const GamepadAuxState& newAuxState);
+
+    // Core1: copy the latest snapshot out, returns false if nothing was published since lastSequence
+    bool read(GamepadState& outState, GamepadAuxState& outAuxState, uint32_t& lastSequence);
+
+    uint32_t getSequence() const { return sequence; }
+private:
+    GamepadStateChannel() {}
+
+    volatile uint32_t sequence = 0;
+    GamepadState state;
+    GamepadAuxState auxState;
+};
+
+#endif
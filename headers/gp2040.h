@@ -21,14 +21,21 @@ public:
     GP2040(){}
     ~GP2040(){}
     void setup();           // setup core0
+    void start();           // bring up USB ahead of the loop
     void run();             // loop core0
+    void process();         // single pass of the core0 input pipeline
 private:
     Gamepad snapshot;
     AddonManager addons;
+    GPDriver * inputDriver = nullptr;
+    bool configMode = false;
     // GPIO debouncer
     void debounceGpioGetAll();
+    void debounceGpioEdges();
     Mask_t buttonGpios;
-    uint32_t gpioDebounceTime[NUM_BANK0_GPIOS];
+    Mask_t eagerGpios = 0;
+    uint32_t gpioDebounceTime[NUM_BANK0_GPIOS] = {};
+    uint32_t gpioEdgeTime[NUM_BANK0_GPIOS] = {};    // edge capture mode only, in microseconds
 
     struct RebootHotkeys {
         RebootHotkeys();
@@ -78,6 +85,7 @@ private:
     std::map<uint32_t, int32_t> bootActions;
 
     void checkSaveRebootState();
+    void processFlashCommit(bool inSlot, uint32_t slotUs);
     bool saveRequested = false;
     bool forceSave = false;
     bool saveSuccessful = false;
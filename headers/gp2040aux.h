@@ -18,6 +18,7 @@ public:
     bool ready(){ return isReady; }
 private:
     GPDriver * inputDriver;
+    Gamepad * core1Gamepad;
     AddonManager addons;
     bool isReady;
 };
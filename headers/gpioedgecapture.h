@@ -0,0 +1,54 @@
+#ifndef _GPIOEDGECAPTURE_H_
+#define _GPIOEDGECAPTURE_H_
+
+#include <stdint.h>
+
+#include "types.h"
+
+// Must be a power of two
+#define GPIO_EDGE_BUFFER_SIZE 64
+
+struct GPIOEdgeEvent {
+    uint32_t timestamp; // time_us_32() when the IRQ fired
+    uint8_t pin;
+    bool pressed;       // level the pin moved to, already inverted (buttons are active low)
+};
+
+/**
+ * @brief Timestamps button GPIO transitions from the bank 0 GPIO IRQ.
+ *
+ * The IRQ handler pushes every edge into a single-producer/single-consumer ring, which
+ * GP2040::debounceGpioGetAll drains on Core0. This lets the debouncer work from the time each
+ * transition actually happened instead of the time the main loop got around to sampling it.
+ */
+class GPIOEdgeCapture {
+public:
+    GPIOEdgeCapture(GPIOEdgeCapture const&) = delete;
+    void operator=(GPIOEdgeCapture const&)  = delete;
+    static GPIOEdgeCapture& getInstance() {
+        static GPIOEdgeCapture instance;
+        return instance;
+    }
+
+    void start(Mask_t pinMask);
+    void stop();
+    bool isRunning() { return pins != 0; }
+
+    bool pop(GPIOEdgeEvent& event);
+
+    // true if edges were dropped since the last call, clears the flag
+    bool takeOverflow();
+private:
+    GPIOEdgeCapture() {}
+
+    static void irqHandler();
+    void push(uint8_t pin, bool pressed, uint32_t timestamp);
+
+    Mask_t pins = 0;
+    GPIOEdgeEvent events[GPIO_EDGE_BUFFER_SIZE];
+    volatile uint32_t head = 0; // only written by the IRQ
+    volatile uint32_t tail = 0; // only written by the consumer
+    volatile bool overflow = false;
+};
+
+#endif
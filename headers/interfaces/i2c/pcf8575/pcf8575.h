@@ -37,14 +37,30 @@ class PCF8575 : public I2CDeviceBase {
 
         uint16_t pins() { return dataReceived; }
 
+        // Pick up the last background read of the pins and, if startRead or a commit() has just been
+        // written, start the next one
+        void update(bool startRead = true);
+        // Write the outputs staged with setPin() in the background, if they changed
+        void commit();
+
+        // Stages the output, commit() sends it
         void setPin(uint8_t pinNumber, uint8_t value);
+        void setPins(uint16_t value) { dataOut = value; }
+        // From the last completed read, see update()
         bool getPin(uint8_t pinNumber);
     private:
         const uint16_t initialValue = 0xFFFF;
         uint8_t uc[128];
 
         uint16_t dataSent;
+        uint16_t dataOut = initialValue;
         uint16_t dataReceived = initialValue;
+
+        I2CTransaction readTransaction;
+        I2CTransaction writeTransaction;
+        uint8_t readBuffer[2];
+        uint8_t writeBuffer[2];
+        bool readAfterWrite = false;
     protected:
         PeripheralI2C* i2c = nullptr;
         uint8_t address = 0;
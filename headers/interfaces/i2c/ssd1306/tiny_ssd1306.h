@@ -86,6 +86,7 @@ class GPGFX_TinySSD1306 : public GPGFX_DisplayBase {
         static const uint16_t MAX_SCREEN_WIDTH = 128;
         static const uint16_t MAX_SCREEN_HEIGHT = 64;
         static const uint16_t MAX_SCREEN_SIZE = (MAX_SCREEN_WIDTH * MAX_SCREEN_HEIGHT / 8);
+        static const uint16_t SH1106_RAM_WIDTH = 132;
 
         GPGFX_DisplayTypeOptions _options;
 
@@ -93,6 +94,8 @@ class GPGFX_TinySSD1306 : public GPGFX_DisplayBase {
         void sendCommands(uint8_t* commands, uint16_t length);
 
         uint8_t frameBuffer[MAX_SCREEN_SIZE];
+        uint8_t panelBuffer[MAX_SCREEN_SIZE]; // what the panel was last sent
+        bool panelValid = false;
         uint8_t framePage = 0;
 
         uint8_t screenType;
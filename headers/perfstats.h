@@ -0,0 +1,132 @@
+#ifndef _PERFSTATS_H_
+#define _PERFSTATS_H_
+
+#include <stdint.h>
+
+#include "hardware/structs/systick.h"
+#include "hardware/timer.h"
+
+// Stages registered by add-ons come after these
+#define PERF_MAX_STAGES 48
+#define PERF_STAGE_NAME_LENGTH 16
+#define PERF_STAGE_NONE 0xFF
+
+// Four buckets per power of two from 64 cycles up, anything past the last one lands in it
+#define PERF_HISTOGRAM_BUCKETS 48
+
+enum PerfStage : uint8_t {
+    PERF_STAGE_CORE0_LOOP,
+    PERF_STAGE_CORE0_EVENTS,
+    PERF_STAGE_DEBOUNCE,
+    PERF_STAGE_READ,
+    PERF_STAGE_TUH_TASK,
+    PERF_STAGE_GAMEPAD,
+    PERF_STAGE_DRIVER,
+    PERF_STAGE_TUD_TASK,
+    PERF_STAGE_FLASH_COMMIT,
+    PERF_STAGE_REPORT_AGE,
+    PERF_STAGE_CORE1_LOOP,
+    PERF_STAGE_CORE1_EVENTS,
+    PERF_STAGE_DRIVER_AUX,
+    PERF_STAGE_FIXED_COUNT
+};
+
+// Add-ons get one stage per phase, registered together so phase is an offset from the first
+enum PerfPhase : uint8_t {
+    PERF_PHASE_NONE = 0,
+    PERF_PHASE_PREPROCESS,
+    PERF_PHASE_PROCESS,
+    PERF_PHASE_POSTPROCESS
+};
+
+struct PerfStageData {
+    char name[PERF_STAGE_NAME_LENGTH];
+    uint8_t core;
+    uint8_t phase;
+    uint32_t count;
+    uint32_t min;       // cycles
+    uint32_t max;
+    uint64_t total;
+    uint16_t buckets[PERF_HISTOGRAM_BUCKETS];
+};
+
+// What the web config and the display get, in nanoseconds
+struct PerfStageSummary {
+    const char* name;
+    uint8_t core;
+    uint8_t phase;
+    uint32_t count;
+    uint32_t min;
+    uint32_t avg;
+    uint32_t max;
+    uint32_t p99;
+};
+
+/**
+ * @brief Per-stage timing of the Core0 and Core1 loops.
+ *
+ * Each core times its own stages with its own SysTick running at the system clock, and keeps
+ * min/max/total plus a log-scale histogram (for p99) per stage in a fixed block of RAM, so a hook is
+ * a register read and a few adds.
+ *
+ * Web config mode skips the Core0 add-ons, so the numbers worth looking at come from the session
+ * before it. The block lives in RAM the runtime doesn't clear, and when we come up in web config
+ * from a software reboot with a valid block in it, that session's numbers are kept and shown instead
+ * of recording new ones.
+ */
+class PerfStats {
+public:
+    PerfStats(PerfStats const&) = delete;
+    void operator=(PerfStats const&)  = delete;
+    static PerfStats& getInstance() {
+        static PerfStats instance;
+        return instance;
+    }
+
+    // Core0, before any add-on is loaded and after the system clock is set
+    void init();
+    // Core1, start its SysTick
+    void initCore();
+
+    // Returns the first of phaseCount stages, or PERF_STAGE_NONE if there's no room or no recording
+    uint8_t addStage(const char* name, uint8_t phaseCount = 1);
+
+    static inline uint32_t now() { return systick_hw->cvr; }
+    static inline uint32_t nowUs() { return time_us_32(); }
+
+    // Record the time since start against a stage, returns now() so stages can be chained. SysTick is
+    // 24 bits and wraps every 2^24 cycles (134 ms at 125 MHz), so this is only for short stages.
+    uint32_t record(uint32_t stage, uint32_t start);
+    // Same from a nowUs() start, for stages that can run long, like anything a flash erase can land in
+    void recordSinceUs(uint32_t stage, uint32_t startUs) { recordUs(stage, nowUs() - startUs); }
+    void recordPhase(uint8_t firstStage, PerfPhase phase, uint32_t start) {
+        record(firstStage + (phase - PERF_PHASE_PREPROCESS), start);
+    }
+    // Record a span measured some other way, in microseconds
+    void recordUs(uint32_t stage, uint32_t us);
+
+    // A frame-synced report that missed the frame it was sampled for
+    void countMissedFrame();
+    uint32_t getMissedFrames() const;
+
+    // An event the other core's queue had no room for
+    void countDroppedEvent();
+    uint32_t getDroppedEvents() const;
+
+    // A USB host report a listener wanted, from an interface the route table had no room for
+    void countDroppedHostReport();
+    uint32_t getDroppedHostReports() const;
+
+    bool isRecording() const { return recording; }
+    uint32_t getStageCount() const;
+    bool getStage(uint32_t stage, PerfStageSummary& summary);
+private:
+    PerfStats() {}
+
+    static void startSysTick();
+    void addSample(uint32_t stage, uint32_t cycles);
+
+    bool recording = false;
+};
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef _REPORTSCHEDULER_H_
+#define _REPORTSCHEDULER_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Lines the Core0 input pipeline up with the host's USB frames.
+ *
+ * Left to itself the main loop samples inputs wherever it happens to be in the 1 ms frame, so a
+ * report can sit in the endpoint buffer for most of a frame before the host polls it. When enabled,
+ * GP2040::process waits here until just before the next start-of-frame, so every driver builds and
+ * queues exactly one report from inputs that are as fresh as possible when the host comes for it.
+ *
+ * Start-of-frame is found by watching the controller's frame counter, and how far ahead of it to
+ * sample is learned from how long the pipeline actually takes (plus a guard band), so slow add-ons
+ * push the sample point earlier instead of making reports miss a frame.
+ */
+class ReportScheduler {
+public:
+    ReportScheduler(ReportScheduler const&) = delete;
+    void operator=(ReportScheduler const&)  = delete;
+    static ReportScheduler& getInstance() {
+        static ReportScheduler instance;
+        return instance;
+    }
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return enabled; }
+
+    // Block until the next frame starts, returns false right away when not synced. The report for it
+    // is already queued, so until getIdleUs() runs out the loop is free to do something else.
+    bool waitForFrame();
+    uint32_t getIdleUs() const;
+
+    // Then block until it's time to sample inputs, returns right away if waitForFrame() didn't sync
+    void waitForSlot();
+
+    // The driver is done with this frame, sent is whether it queued a report. Report age and missed
+    // frames go to PerfStats so they outlast the reboot into web config.
+    void markReported(bool sent);
+private:
+    ReportScheduler() {}
+
+    bool pollFrame(uint32_t now);
+
+    bool enabled = false;
+    bool framed = false;         // waitForFrame() caught the start of frame
+    bool sampled = false;        // sampled inputs for the frame after sampleFrame
+    uint32_t frame = 0;          // last frame number seen
+    uint32_t frameSeenUs = 0;    // when the frame number last changed
+    uint32_t sampleFrame = 0;
+    uint32_t sampleSofUs = 0;    // when sampleFrame started
+    uint32_t sampleUs = 0;
+    uint32_t leadUs = 0;
+};
+
+#endif
@@ -49,6 +49,7 @@ public:
 	void init();
 	bool save();
 	bool save(const bool force);
+	bool takeSaveAfterLoad();			// true once, if init() loaded a config that still needs saving
 
 	void SetGamepad(Gamepad *); 		// MPGS Gamepad Get/Set
 	Gamepad * GetGamepad();
@@ -56,6 +57,8 @@ public:
 	void SetProcessedGamepad(Gamepad *); // MPGS Processed Gamepad Get/Set
 	Gamepad * GetProcessedGamepad();
 
+	void SetCore1Gamepad(Gamepad *);	// Core1's snapshot of the processed gamepad
+
 	bool setProfile(const uint32_t);		// profile support for multiple mappings
 	void nextProfile();
 	void previousProfile();
@@ -69,8 +72,10 @@ public:
 private:
 	Storage() {}
 	bool CONFIG_MODE = false; 			// Config mode (boot)
+	bool saveAfterLoad = false;
 	Gamepad * gamepad = nullptr;    		// Gamepad data
 	Gamepad * processedGamepad = nullptr; // Gamepad with ONLY processed data
+	Gamepad * core1Gamepad = nullptr;	// Processed data as last published to Core1
 	uint8_t featureData[32]; // USB X-Input Feature Data
 	Config config;
 	GpioMappingInfo functionalPinMappings[NUM_BANK0_GPIOS];
@@ -29,6 +29,8 @@ namespace System {
     void reboot(BootMode bootMode);
     // Retrieves the BootMode value from the watchdog scratch register and resets its value to BootMode::DEFAULT
     BootMode takeBootMode();
+    // Same as takeBootMode, but leaves the scratch register alone
+    BootMode peekBootMode();
 }
 
 #endif
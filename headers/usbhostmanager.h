@@ -12,6 +12,33 @@
 // USB Host manager decides on TinyUSB Host driver
 usbh_class_driver_t const* usbh_app_driver_get_cb(uint8_t *driver_count);
 
+// Mounted interfaces (dev_addr/instance/class) that reports can be routed for
+#ifndef USB_HOST_ROUTE_COUNT
+#define USB_HOST_ROUTE_COUNT 16
+#endif
+
+#define USB_HOST_REPORT_MAX_LENGTH 64
+
+// HID and XInput number their instances separately, so the same dev_addr/instance can be one of each
+enum USBHostRouteClass : uint8_t {
+    USB_HOST_ROUTE_HID,
+    USB_HOST_ROUTE_XINPUT,
+};
+
+// Listeners that asked for reports from one interface. Interfaces whose reports only carry
+// the current state keep the newest one here until the end of process(), everything else
+// is handed over as it arrives.
+struct USBHostRoute {
+    uint8_t dev_addr;
+    uint8_t instance;
+    USBHostRouteClass routeClass;
+    uint32_t listenerMask;      // bit n is listeners[n]
+    bool latestOnly;            // every listener in the mask only needs the newest report
+    bool pending;
+    uint16_t len;
+    uint8_t report[USB_HOST_REPORT_MAX_LENGTH];
+};
+
 class USBHostManager {
 public:
 	USBHostManager(USBHostManager const&) = delete;
@@ -36,7 +63,15 @@ public:
     
 private:
     USBHostManager() : tuh_ready(false), core0Ready(false), core1Ready(false) {}
+    void addRoute(uint8_t dev_addr, uint8_t instance, USBHostRouteClass routeClass);
+    void removeRoutes(uint8_t dev_addr, uint8_t instance, USBHostRouteClass routeClass, bool allInstances);
+    USBHostRoute * findRoute(uint8_t dev_addr, uint8_t instance, USBHostRouteClass routeClass);
+    void routeReport(uint8_t dev_addr, uint8_t instance, USBHostRouteClass routeClass, uint8_t const* report, uint16_t len);
+    void deliverReport(USBHostRoute & route, uint8_t const* report, uint16_t len);
+    void deliverLatestReports();
     std::vector<USBListener*> listeners;
+    USBHostRoute routes[USB_HOST_ROUTE_COUNT] = {};
+    uint8_t routeCount = 0;
     usb_device_t *usb_device;
     uint8_t dataPin;
     bool tuh_ready;
@@ -14,6 +14,14 @@ public:
     virtual void report_sent(uint8_t dev_addr, uint8_t instance, uint8_t const* report, uint16_t len) = 0;
     virtual void set_report_complete(uint8_t dev_addr, uint8_t instance, uint8_t report_id, uint8_t report_type, uint16_t len) = 0;
     virtual void get_report_complete(uint8_t dev_addr, uint8_t instance, uint8_t report_id, uint8_t report_type, uint16_t len) = 0;
+
+    // Asked right after mount/xmount: should reports from this interface be routed here
+    virtual bool wantsReports(uint8_t dev_addr, uint8_t instance) { return true; }
+
+    // Each report from this interface fully replaces the last (buttons, sticks), so when several
+    // are queued only the newest needs to be handed over. Relative data (mouse motion) and
+    // protocol traffic (auth) needs every report.
+    virtual bool latestReportOnly(uint8_t dev_addr, uint8_t instance) { return false; }
 };
 
 #endif
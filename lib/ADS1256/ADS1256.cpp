@@ -12,7 +12,12 @@ Special thanks to Abraão Queiroz for spending time on the code and suggesting c
 
 #include "ADS1256.h"
 #include <cstdio>
+#include <cstring>
 #include <math.h>
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/gpio.h"
+#include "hardware/irq.h"
 #include "hardware/sync.h"
 #include "pico.h"
 #include "pico/stdlib.h"
@@ -730,3 +735,158 @@ uint32_t ADS1256::cycleDifferential() {
 
     return _outputValue;
 }
+
+ADS1256 *ADS1256::_cyclingInstance = nullptr;
+static bool dmaHandlerAdded = false;
+
+void ADS1256::startCycling(const uint8_t *muxValues, uint8_t count) {
+    stopCycling();
+    if ((_DRDY_pin < 0) || (count == 0) || (count > ADS1256_CHANNEL_COUNT) || (_cyclingInstance != nullptr)) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        _cycleMux[i] = muxValues[i];
+        _cycledValues[i] = 0;
+    }
+    _cycleLength = count;
+    _cycleIndex = 0;
+    _cyclePasses = 0;
+    _cyclingInstance = this;
+
+    // Start the first conversion by hand, every DRDY after that starts the next one
+    _SPI->beginTransaction(_SPISpeed, _SPIBitOrder, _SPIMode);
+    waitForDRDY();
+    _SPI->select(_CS_pin);
+    _SPI->transfer(ADS1256_CMD_WREG | ADS1256_REG_MUX);
+    _SPI->transfer(0x00);
+    _SPI->transfer(_cycleMux[0]);
+    _SPI->transfer(ADS1256_CMD_SYNC);
+    sleep_us(4); // t11
+    _SPI->transfer(ADS1256_CMD_WAKEUP);
+    _SPI->deselect();
+
+    // The sequence from cycleSingle(), the MUX value is filled in for each conversion
+    const uint8_t sequence[ADS1256_CYCLE_BYTES] = { ADS1256_CMD_WREG | ADS1256_REG_MUX, 0x00, 0x00, ADS1256_CMD_SYNC, ADS1256_CMD_WAKEUP, ADS1256_CMD_RDATA, 0x00, 0x00, 0x00 };
+    memcpy(_cycleTx, sequence, sizeof(_cycleTx));
+
+    if (_dmaTxChannel < 0) {
+        _dmaTxChannel = dma_claim_unused_channel(true);
+        _dmaRxChannel = dma_claim_unused_channel(true);
+        _dmaTimer = dma_claim_unused_timer(true);
+    }
+
+    // The timer paces the TX channel to one byte per byte time plus the gap, so the ADC sees the
+    // same delays the blocking sequence waits out with sleep_us()
+    const uint64_t spacingNs = (8000000000ull / _SPISpeed) + (ADS1256_CYCLE_GAP_US * 1000);
+    const uint64_t divider = ((uint64_t)clock_get_hz(clk_sys) * spacingNs) / 1000000000ull;
+    dma_timer_set_fraction(_dmaTimer, 1, (divider > 0xFFFF) ? 0xFFFF : (uint16_t)divider);
+
+    spi_inst_t *spi = _SPI->getController();
+    dma_channel_config txConfig = dma_channel_get_default_config(_dmaTxChannel);
+    channel_config_set_transfer_data_size(&txConfig, DMA_SIZE_8);
+    channel_config_set_read_increment(&txConfig, true);
+    channel_config_set_write_increment(&txConfig, false);
+    channel_config_set_dreq(&txConfig, dma_get_timer_dreq(_dmaTimer));
+    dma_channel_configure(_dmaTxChannel, &txConfig, &spi_get_hw(spi)->dr, _cycleTx, ADS1256_CYCLE_BYTES, false);
+
+    dma_channel_config rxConfig = dma_channel_get_default_config(_dmaRxChannel);
+    channel_config_set_transfer_data_size(&rxConfig, DMA_SIZE_8);
+    channel_config_set_read_increment(&rxConfig, false);
+    channel_config_set_write_increment(&rxConfig, true);
+    channel_config_set_dreq(&rxConfig, spi_get_dreq(spi, false));
+    dma_channel_configure(_dmaRxChannel, &rxConfig, _cycleRx, &spi_get_hw(spi)->dr, ADS1256_CYCLE_BYTES, false);
+
+    dma_channel_acknowledge_irq0(_dmaRxChannel);
+    dma_channel_set_irq0_enabled(_dmaRxChannel, true);
+    if (!dmaHandlerAdded) {
+        irq_add_shared_handler(DMA_IRQ_0, &ADS1256::dmaIRQ, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+        irq_set_enabled(DMA_IRQ_0, true);
+        dmaHandlerAdded = true;
+    }
+
+    // DRDY is high until that conversion is done, anything latched before now is stale
+    gpio_acknowledge_irq(_DRDY_pin, GPIO_IRQ_EDGE_FALL);
+    gpio_set_irq_enabled(_DRDY_pin, GPIO_IRQ_EDGE_FALL, true);
+    gpio_add_raw_irq_handler(_DRDY_pin, &ADS1256::drdyIRQ);
+    irq_set_enabled(IO_IRQ_BANK0, true);
+}
+
+void ADS1256::stopCycling() {
+    if (_cyclingInstance != this) {
+        return;
+    }
+
+    gpio_set_irq_enabled(_DRDY_pin, GPIO_IRQ_EDGE_FALL, false);
+    gpio_remove_raw_irq_handler(_DRDY_pin, &ADS1256::drdyIRQ);
+
+    // A transfer could still be running, its interrupt mustn't be left pending without a handler
+    dma_channel_set_irq0_enabled(_dmaRxChannel, false);
+    dma_channel_abort(_dmaTxChannel);
+    dma_channel_abort(_dmaRxChannel);
+    dma_channel_acknowledge_irq0(_dmaRxChannel);
+    _SPI->deselect();
+
+    _cyclingInstance = nullptr;
+    _cycleLength = 0;
+}
+
+// Runs in the bank 0 GPIO interrupt it shares with GPIOEdgeCapture, so button edges that come in
+// meanwhile are timestamped late by as long as this takes. It only kicks off the DMA transfer, a
+// couple of microseconds, instead of shifting the whole sequence out itself.
+void __not_in_flash_func(ADS1256::drdyIRQ)() {
+    ADS1256 *ads = _cyclingInstance;
+    if ((ads == nullptr) || !(gpio_get_irq_event_mask(ads->_DRDY_pin) & GPIO_IRQ_EDGE_FALL)) {
+        return;
+    }
+
+    gpio_acknowledge_irq(ads->_DRDY_pin, GPIO_IRQ_EDGE_FALL);
+    ads->cycleNext();
+}
+
+void __not_in_flash_func(ADS1256::dmaIRQ)() {
+    ADS1256 *ads = _cyclingInstance;
+    if ((ads == nullptr) || !dma_channel_get_irq0_status(ads->_dmaRxChannel)) {
+        return;
+    }
+
+    dma_channel_acknowledge_irq0(ads->_dmaRxChannel);
+    ads->cycleDone();
+}
+
+// The conversion for _cycleIndex just finished. The MUX is pointed at the next input and that
+// conversion started before this one is read out, so the ADC never sits idle waiting on SPI.
+// REF: P21, "Cycling the ADS1256 Input Multiplexer", and the sequence in cycleSingle().
+void __not_in_flash_func(ADS1256::cycleNext)() {
+    // The sequence takes well under a conversion, an edge while it's still going is skipped
+    if (dma_channel_is_busy(_dmaRxChannel)) {
+        return;
+    }
+
+    uint8_t next = _cycleIndex + 1;
+    if (next == _cycleLength) {
+        next = 0;
+    }
+    _cycleNext = next;
+    _cycleTx[2] = _cycleMux[next];
+
+    spi_inst_t *spi = _SPI->getController();
+    while (spi_is_readable(spi)) {
+        (void)spi_get_hw(spi)->dr;
+    }
+
+    _SPI->select(_CS_pin);
+    dma_channel_set_write_addr(_dmaRxChannel, _cycleRx, true);
+    dma_channel_set_read_addr(_dmaTxChannel, _cycleTx, true);
+}
+
+// The last data byte is in, RDATA's result is the conversion cycleNext() found finished
+void __not_in_flash_func(ADS1256::cycleDone)() {
+    _SPI->deselect();
+
+    _cycledValues[_cycleIndex] = ((uint32_t)_cycleRx[6] << 16) | ((uint32_t)_cycleRx[7] << 8) | (_cycleRx[8]);
+    if (_cycleNext == 0) {
+        _cyclePasses = _cyclePasses + 1;
+    }
+    _cycleIndex = _cycleNext;
+}
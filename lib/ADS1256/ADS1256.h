@@ -20,6 +20,12 @@
 #define ADS1256_VREF_VOLTAGE 2.5f
 #define ADS1256_CHANNEL_COUNT 8
 
+// Bytes DMA clocks out per cycled conversion: WREG MUX, 0, the MUX value, SYNC, WAKEUP, RDATA and
+// the three data bytes. Each one is followed by a gap of at least t6 (~6.51 us), which also covers
+// t11 between SYNC and WAKEUP.
+#define ADS1256_CYCLE_BYTES 9
+#define ADS1256_CYCLE_GAP_US 7
+
 #ifndef ADS1256_DEBUG
 #define ADS1256_DEBUG false
 #endif
@@ -186,6 +192,19 @@ public:
     // Cycling through the differential inputs
     uint32_t cycleDifferential(); // Ax + Ay
 
+    // Cycle through the given MUX settings in the background, one conversion each. The DRDY interrupt
+    // starts a DMA transfer of the cycling sequence, the DMA interrupt stores the result. Together
+    // they own the SPI bus and claim two DMA channels and a DMA timer until stopCycling().
+    void startCycling(const uint8_t *muxValues, uint8_t count);
+    void stopCycling();
+    bool isCycling() { return _cycleLength > 0; }
+
+    // Latest raw conversion of muxValues[index]
+    uint32_t getCycledValue(uint8_t index) { return _cycledValues[index]; }
+
+    // Complete passes through all the inputs since startCycling()
+    uint32_t getCyclePasses() { return _cyclePasses; }
+
     // Converts the reading into a voltage value
     float convertToVoltage(int32_t rawData);
 
@@ -195,6 +214,11 @@ public:
 private:
     void waitForDRDY();
 
+    static void drdyIRQ();
+    static void dmaIRQ();
+    void cycleNext();
+    void cycleDone();
+
     PeripheralSPI *_SPI;
 
     float _VREF; // Value of the reference voltage
@@ -228,6 +252,20 @@ private:
     // uint32_t _outputValue;      // Combined value of the _outputBuffer[3]
     bool _isAcquisitionRunning; // bool that keeps track of the acquisition (running or not)
     uint8_t _cycle;             // Tracks the cycles as the MUX is cycling through the input channels
+
+    // Background cycling, see startCycling()
+    static ADS1256 *_cyclingInstance;
+    uint8_t _cycleMux[ADS1256_CHANNEL_COUNT];
+    uint8_t _cycleLength = 0;
+    uint8_t _cycleIndex = 0; // input whose conversion is running
+    uint8_t _cycleNext = 0;  // input the DMA transfer in flight points the MUX at
+    uint8_t _cycleTx[ADS1256_CYCLE_BYTES];
+    uint8_t _cycleRx[ADS1256_CYCLE_BYTES];
+    int _dmaTxChannel = -1;
+    int _dmaRxChannel = -1;
+    int _dmaTimer = -1;
+    volatile uint32_t _cycledValues[ADS1256_CHANNEL_COUNT] = {};
+    volatile uint32_t _cyclePasses = 0;
 };
 
 #endif
@@ -0,0 +1,246 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+#include "FlashJournal.h"
+#include "CRC32.h"
+
+#include <stddef.h>
+
+static inline uint32_t alignUp(uint32_t value, uint32_t alignment)
+{
+	return (value + alignment - 1) & ~(alignment - 1);
+}
+
+static inline const uint8_t *flashAt(uint32_t offset)
+{
+	return reinterpret_cast<const uint8_t *>(EEPROM_ADDRESS_START) + offset;
+}
+
+static bool isBlank(uint32_t offset, uint32_t size)
+{
+	const uint32_t *words = reinterpret_cast<const uint32_t *>(flashAt(offset));
+	for (uint32_t i = 0; i < size / sizeof(uint32_t); i++) {
+		if (words[i] != 0xFFFFFFFF)
+			return false;
+	}
+	return true;
+}
+
+uint32_t FlashJournal::recordSize(uint32_t dataSize)
+{
+	return alignUp(sizeof(FlashJournalHeader) + dataSize, EEPROM_PAGE_SIZE);
+}
+
+bool FlashJournal::readRecord(uint32_t offset, FlashJournalRecord &record)
+{
+	const FlashJournalHeader &header = *reinterpret_cast<const FlashJournalHeader *>(flashAt(offset));
+	if (header.magic != FLASH_JOURNAL_MAGIC)
+		return false;
+
+	if (CRC32::calculate(reinterpret_cast<const uint8_t *>(&header), offsetof(FlashJournalHeader, headerCrc)) != header.headerCrc)
+		return false;
+
+	if (offset + recordSize(header.dataSize) > EEPROM_SIZE_BYTES)
+		return false;
+
+	record.offset = offset;
+	record.sequence = header.sequence;
+	record.dataSize = header.dataSize;
+	record.type = header.type;
+	return true;
+}
+
+// The header checked out, make sure the data behind it did too
+static bool isIntact(const FlashJournalRecord &record)
+{
+	const FlashJournalHeader &header = *reinterpret_cast<const FlashJournalHeader *>(flashAt(record.offset));
+	return CRC32::calculate(record.data(), record.dataSize) == header.dataCrc;
+}
+
+bool FlashJournal::findRecord(uint32_t sequence, FlashJournalRecord &record)
+{
+	for (uint32_t offset = 0; offset < EEPROM_SIZE_BYTES;) {
+		if (!readRecord(offset, record)) {
+			offset += EEPROM_PAGE_SIZE;
+			continue;
+		}
+		if (record.sequence == sequence)
+			return isIntact(record);
+		offset += recordSize(record.dataSize);
+	}
+	return false;
+}
+
+bool FlashJournal::open()
+{
+	FlashJournalRecord record;
+	FlashJournalRecord snapshot;
+	uint32_t maxSequence = 0;
+
+	snapshotValid = false;
+	staleRecords = false;
+	deltaCount = 0;
+
+	// Find the newest snapshot that is intact
+	for (uint32_t offset = 0; offset < EEPROM_SIZE_BYTES;) {
+		if (!readRecord(offset, record)) {
+			offset += EEPROM_PAGE_SIZE;
+			continue;
+		}
+		if (record.sequence > maxSequence)
+			maxSequence = record.sequence;
+		if (record.type == FLASH_JOURNAL_SNAPSHOT && (!snapshotValid || record.sequence > snapshot.sequence) && isIntact(record)) {
+			snapshot = record;
+			snapshotValid = true;
+		}
+		offset += recordSize(record.dataSize);
+	}
+
+	sequence = maxSequence + 1;
+	if (!snapshotValid) {
+		liveStart = head = erasedEnd = 0;
+		lastSequence = 0;
+		return false;
+	}
+
+	// Follow the deltas after it for as long as they are intact and unbroken
+	FlashJournalRecord last = snapshot;
+	while (findRecord(last.sequence + 1, record) && record.type == FLASH_JOURNAL_DELTA) {
+		last = record;
+		deltaCount++;
+	}
+
+	liveStart = snapshot.offset;
+	lastSequence = last.sequence;
+	head = last.offset + recordSize(last.dataSize);
+	if (head >= EEPROM_SIZE_BYTES)
+		head = 0;
+	staleRecords = maxSequence > lastSequence;
+
+	erasedEnd = head;
+	while (erasedEnd < EEPROM_SIZE_BYTES && isBlank(erasedEnd, EEPROM_PAGE_SIZE))
+		erasedEnd += EEPROM_PAGE_SIZE;
+
+	return true;
+}
+
+bool FlashJournal::first(FlashJournalRecord &record)
+{
+	return snapshotValid && readRecord(liveStart, record);
+}
+
+bool FlashJournal::next(FlashJournalRecord &record)
+{
+	if (record.sequence >= lastSequence)
+		return false;
+	return findRecord(record.sequence + 1, record);
+}
+
+bool FlashJournal::isLive(uint32_t sectorStart)
+{
+	if (!snapshotValid)
+		return false;
+
+	uint32_t sectorEnd = sectorStart + EEPROM_SECTOR_SIZE;
+	if (liveStart < head)
+		return sectorStart < head && sectorEnd > liveStart;
+	return sectorStart < head || sectorEnd > liveStart;
+}
+
+bool FlashJournal::plan(uint32_t size, bool keepLive, uint32_t &offset, uint32_t &eraseStart, uint32_t &eraseEnd)
+{
+	if (size > EEPROM_SIZE_BYTES)
+		return false;
+
+	offset = head;
+	eraseStart = eraseEnd = 0;
+	if (offset + size <= erasedEnd)
+		return true;
+
+	// Anything past erasedEnd has to be erased first, which can only be done a whole sector at a time
+	if (erasedEnd % EEPROM_SECTOR_SIZE != 0)
+		offset = alignUp(erasedEnd, EEPROM_SECTOR_SIZE);
+	else if (erasedEnd != head)
+		offset = head;
+	if (offset + size > EEPROM_SIZE_BYTES) {
+		offset = 0;
+		eraseStart = 0;
+	} else {
+		eraseStart = (offset == head) ? erasedEnd : offset;
+	}
+	eraseEnd = alignUp(offset + size, EEPROM_SECTOR_SIZE);
+
+	if (keepLive) {
+		for (uint32_t sector = eraseStart; sector < eraseEnd; sector += EEPROM_SECTOR_SIZE) {
+			if (isLive(sector))
+				return false;
+		}
+	}
+	return true;
+}
+
+bool FlashJournal::canAppend(uint32_t dataSize)
+{
+	uint32_t offset, eraseStart, eraseEnd;
+	return plan(recordSize(dataSize), true, offset, eraseStart, eraseEnd);
+}
+
+bool FlashJournal::write(FlashJournalRecordType type, uint8_t *buffer, uint32_t dataSize, bool keepLive)
+{
+	uint32_t size = recordSize(dataSize);
+	uint32_t offset, eraseStart, eraseEnd;
+	if (!plan(size, keepLive, offset, eraseStart, eraseEnd))
+		return false;
+
+	FlashJournalHeader &header = *reinterpret_cast<FlashJournalHeader *>(buffer);
+	header.magic = FLASH_JOURNAL_MAGIC;
+	header.sequence = sequence;
+	header.dataSize = dataSize;
+	header.dataCrc = CRC32::calculate(buffer + sizeof(FlashJournalHeader), dataSize);
+	header.type = type;
+	header.reserved[0] = header.reserved[1] = header.reserved[2] = 0;
+	header.headerCrc = CRC32::calculate(buffer, offsetof(FlashJournalHeader, headerCrc));
+	memset(buffer + sizeof(FlashJournalHeader) + dataSize, 0xFF, size - sizeof(FlashJournalHeader) - dataSize);
+
+	// Erase and program from the main loop a step at a time. Nothing current gets erased and the record's
+	// CRCs don't match until its last page is down, so stopping anywhere in between is safe.
+	if (eraseEnd > eraseStart) {
+		EEPROM.queue(eraseStart, eraseEnd - eraseStart, offset, buffer, size);
+		erasedEnd = eraseEnd;
+	} else {
+		EEPROM.queue(0, 0, offset, buffer, size);
+	}
+
+	if (type == FLASH_JOURNAL_SNAPSHOT) {
+		liveStart = offset;
+		snapshotValid = true;
+		deltaCount = 0;
+		// Its sequence is past every stale record, so deltas can chain off it again. The queue runs
+		// in order, so nothing appended after this can land before it's complete.
+		staleRecords = false;
+	} else {
+		deltaCount++;
+	}
+	lastSequence = sequence++;
+	head = offset + size;
+	if (head >= EEPROM_SIZE_BYTES)
+		head = erasedEnd = 0;
+	return true;
+}
+
+bool FlashJournal::append(FlashJournalRecordType type, uint8_t *buffer, uint32_t dataSize)
+{
+	// a delta on its own means nothing
+	if (type == FLASH_JOURNAL_DELTA && !snapshotValid)
+		return false;
+	return write(type, buffer, dataSize, true);
+}
+
+bool FlashJournal::rewrite(uint8_t *buffer, uint32_t dataSize)
+{
+	// start over at the beginning of the block, everything after the new snapshot is stale
+	head = erasedEnd = 0;
+	return write(FLASH_JOURNAL_SNAPSHOT, buffer, dataSize, false);
+}
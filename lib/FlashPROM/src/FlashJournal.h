@@ -0,0 +1,96 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2024 OpenStickCommunity (gp2040-ce.info)
+ */
+
+#ifndef FLASHJOURNAL_H_
+#define FLASHJOURNAL_H_
+
+#include <stdint.h>
+
+#include "FlashPROM.h"
+
+#define FLASH_JOURNAL_MAGIC 0x4c4e524a // "JRNL"
+
+enum FlashJournalRecordType : uint8_t
+{
+	FLASH_JOURNAL_SNAPSHOT = 1, // complete data, replaces everything before it
+	FLASH_JOURNAL_DELTA    = 2, // applied on top of the previous record
+};
+
+// Every record starts on a page boundary with this header, followed by dataSize bytes of data
+struct FlashJournalHeader
+{
+	uint32_t magic;
+	uint32_t sequence;
+	uint32_t dataSize;
+	uint32_t dataCrc;
+	uint8_t type;
+	uint8_t reserved[3];
+	uint32_t headerCrc; // covers everything above
+};
+
+struct FlashJournalRecord
+{
+	uint32_t offset;
+	uint32_t sequence;
+	uint32_t dataSize;
+	uint8_t type;
+
+	const uint8_t *data() const { return reinterpret_cast<const uint8_t *>(EEPROM_ADDRESS_START) + offset + sizeof(FlashJournalHeader); }
+};
+
+/**
+ * @brief Append-only record log on top of the FlashPROM block.
+ *
+ * Records are appended page by page and a sector is only erased when the log first moves into it, so
+ * a small change costs a page program instead of a full erase and reprogram, and erases are spread
+ * across the whole block. The latest snapshot plus the unbroken chain of deltas after it is the
+ * current state; anything else is dead and gets erased as the log wraps back around to it.
+ *
+ * A record that was only partly written when power was lost fails its CRC and ends the chain, so
+ * recovery always lands on the last record that was completely written.
+ */
+class FlashJournal
+{
+	public:
+		// Scan flash for the current snapshot and its deltas, returns false if there is no snapshot
+		bool open();
+
+		// Current records in the order they have to be applied, starting with the snapshot
+		bool first(FlashJournalRecord &record);
+		bool next(FlashJournalRecord &record);
+
+		// buffer holds a FlashJournalHeader followed by dataSize bytes, with room to pad it out to a
+		// whole page. Returns false if the record would not fit without erasing current records.
+		// The write is queued on EEPROM, buffer has to stay untouched until EEPROM.isBusy() is false.
+		bool append(FlashJournalRecordType type, uint8_t *buffer, uint32_t dataSize);
+		bool canAppend(uint32_t dataSize);
+
+		// Last resort when there's no room for a snapshot: write it at the start of the block
+		// without regard for the current records. Not safe against power loss.
+		bool rewrite(uint8_t *buffer, uint32_t dataSize);
+
+		uint32_t getDeltaCount() const { return deltaCount; }
+		bool hasSnapshot() const { return snapshotValid; }
+		bool hasStaleRecords() const { return staleRecords; }
+
+		static uint32_t recordSize(uint32_t dataSize);
+	private:
+		bool findRecord(uint32_t sequence, FlashJournalRecord &record);
+		bool readRecord(uint32_t offset, FlashJournalRecord &record);
+		bool plan(uint32_t size, bool keepLive, uint32_t &offset, uint32_t &eraseStart, uint32_t &eraseEnd);
+		bool isLive(uint32_t sectorStart);
+		bool write(FlashJournalRecordType type, uint8_t *buffer, uint32_t dataSize, bool keepLive);
+
+		uint32_t sequence = 1;      // sequence number for the next record
+		uint32_t lastSequence = 0;  // sequence number of the last current record
+		uint32_t liveStart = 0;     // offset of the current snapshot
+		uint32_t head = 0;          // offset just past the last current record
+		uint32_t erasedEnd = 0;     // flash from head up to here is known to be erased
+		uint32_t deltaCount = 0;
+		bool snapshotValid = false;
+		bool staleRecords = false;  // saw records newer than the chain we recovered, until the next snapshot
+};
+
+#endif
@@ -6,48 +6,79 @@
 #include "FlashPROM.h"
 
 uint8_t FlashPROM::writeCache[EEPROM_SIZE_BYTES];
-volatile static alarm_id_t flashWriteAlarm = 0;
 volatile static spin_lock_t *flashLock = nullptr;
 
-int64_t writeToFlash(alarm_id_t id, void *flashCache)
+void FlashPROM::start()
+{
+	if (flashLock == nullptr)
+		flashLock = spin_lock_instance(spin_lock_claim_unused(true));
+}
+
+void FlashPROM::erase(uint32_t offset, uint32_t size)
 {
 	while (is_spin_locked(flashLock));
 
 	multicore_lockout_start_blocking();
 	uint32_t interrupts = spin_lock_blocking(flashLock);
 
-	flash_range_erase((intptr_t)EEPROM_ADDRESS_START - (intptr_t)XIP_BASE, EEPROM_SIZE_BYTES);
-	flash_range_program((intptr_t)EEPROM_ADDRESS_START - (intptr_t)XIP_BASE, reinterpret_cast<uint8_t *>(flashCache), EEPROM_SIZE_BYTES);
+	flash_range_erase((intptr_t)EEPROM_ADDRESS_START - (intptr_t)XIP_BASE + offset, size);
 
-	flashWriteAlarm = 0;
+	multicore_lockout_end_blocking();
+	spin_unlock(flashLock, interrupts);
+}
+
+void FlashPROM::program(uint32_t offset, const uint8_t *data, uint32_t size)
+{
+	while (is_spin_locked(flashLock));
+
+	multicore_lockout_start_blocking();
+	uint32_t interrupts = spin_lock_blocking(flashLock);
+
+	flash_range_program((intptr_t)EEPROM_ADDRESS_START - (intptr_t)XIP_BASE + offset, data, size);
 
 	multicore_lockout_end_blocking();
 	spin_unlock(flashLock, interrupts);
+}
+
+void FlashPROM::queue(uint32_t eraseOffset, uint32_t eraseSize, uint32_t programOffset, const uint8_t *data, uint32_t programSize)
+{
+	flush();
 
-	return 0;
+	this->eraseOffset = eraseOffset;
+	this->eraseEnd = eraseOffset + eraseSize;
+	this->programOffset = programOffset;
+	this->programEnd = programOffset + programSize;
+	this->programData = data;
+
+	stepsDone = 0;
+	stepsTotal = eraseSize / EEPROM_SECTOR_SIZE + programSize / EEPROM_PAGE_SIZE;
 }
 
-void FlashPROM::start()
+bool FlashPROM::step()
 {
-	if (flashLock == nullptr)
-		flashLock = spin_lock_instance(spin_lock_claim_unused(true));
+	if (!isBusy())
+		return false;
+
+	// Erase everything first, the program steps may be writing into the erased sectors
+	if (eraseOffset < eraseEnd) {
+		erase(eraseOffset, EEPROM_SECTOR_SIZE);
+		eraseOffset += EEPROM_SECTOR_SIZE;
+	} else {
+		program(programOffset, programData, EEPROM_PAGE_SIZE);
+		programOffset += EEPROM_PAGE_SIZE;
+		programData += EEPROM_PAGE_SIZE;
+	}
 
-	memcpy(writeCache, reinterpret_cast<uint8_t *>(EEPROM_ADDRESS_START), EEPROM_SIZE_BYTES);
+	stepsDone++;
+	return isBusy();
 }
 
-/* We don't have an actual EEPROM, so we need to be extra careful about minimizing writes. Instead
-	of writing when a commit is requested, we update a time to actually commit. That way, if we receive multiple requests
-	to commit in that timeframe, we'll hold off until the user is done sending changes. */
-void FlashPROM::commit()
+void FlashPROM::flush()
 {
-	while (is_spin_locked(flashLock));
-	if (flashWriteAlarm != 0)
-		cancel_alarm(flashWriteAlarm);
-	flashWriteAlarm = add_alarm_in_ms(EEPROM_WRITE_WAIT, writeToFlash, writeCache, true);
+	while (step());
 }
 
 void FlashPROM::reset()
 {
-	memset(writeCache, 0, EEPROM_SIZE_BYTES);
-	commit();
+	queue(0, EEPROM_SIZE_BYTES, 0, nullptr, 0);
 }
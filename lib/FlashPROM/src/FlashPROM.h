@@ -16,17 +16,41 @@
 #define EEPROM_SIZE_BYTES    0x8000           // Reserve 32k of flash memory (ensure this value is divisible by 256)
 #define EEPROM_ADDRESS_START _u(0x101F8000) // The arduino-pico EEPROM lib starts here, so we'll do the same
 
-// Warning: If the write wait is too long it can stall other processes
-#define EEPROM_WRITE_WAIT    50             // Amount of time in ms to wait before blocking core1 and committing to flash
+#define EEPROM_SECTOR_SIZE   FLASH_SECTOR_SIZE // Smallest unit that can be erased
+#define EEPROM_PAGE_SIZE     FLASH_PAGE_SIZE   // Smallest unit that can be programmed
 
 class FlashPROM
 {
 	public:
 		void start();
-		void commit();
-		void reset();
-
+		void reset();  // queues an erase of the whole block, see step()
+
+		// Write directly to flash, bypassing the cache. Offsets are relative to EEPROM_ADDRESS_START.
+		void erase(uint32_t offset, uint32_t size);                         // whole sectors
+		void program(uint32_t offset, const uint8_t *data, uint32_t size);  // whole pages, data must be in RAM
+
+		// Same as above, but carried out one sector erase or page program per call to step(), so Core1 is
+		// only ever locked out for one of them at a time. That bounds a page program to well under a
+		// frame, a sector erase still takes 45-400 ms. data has to stay put until the queue is empty.
+		void queue(uint32_t eraseOffset, uint32_t eraseSize, uint32_t programOffset, const uint8_t *data, uint32_t programSize);
+		bool step();   // returns true while there's work left
+		void flush();  // finish everything that's queued right now
+		bool isBusy() const { return stepsDone < stepsTotal; }
+		bool isErasing() const { return eraseOffset < eraseEnd; }  // the next step is a sector erase
+		uint32_t getStepsDone() const { return stepsDone; }
+		uint32_t getStepsTotal() const { return stepsTotal; }
+
+		// Scratch space for building what gets programmed, not a copy of the flash contents. Read
+		// the current contents straight from EEPROM_ADDRESS_START.
 		static uint8_t writeCache[EEPROM_SIZE_BYTES];
+	private:
+		uint32_t eraseOffset = 0;
+		uint32_t eraseEnd = 0;
+		uint32_t programOffset = 0;
+		uint32_t programEnd = 0;
+		const uint8_t *programData = nullptr;
+		uint32_t stepsDone = 0;
+		uint32_t stepsTotal = 0;
 };
 
 inline FlashPROM EEPROM;
@@ -12,8 +12,22 @@
 #include "pico/stdlib.h"
 #include "hardware/pio.h"
 #include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
 #include "NeoPico.h"
 
+#define NEOPICO_DMA_IRQ DMA_IRQ_1
+
+// Data sheets ask for 50us to latch, newer WS2812B parts need 280us
+#define NEOPICO_RESET_US 300
+
+// One bit at 800kHz is 1.25us, the joined TX FIFO holds 8 words
+#define NEOPICO_FIFO_WORDS 8
+
+static int programOffset[NUM_PIOS] = { -1, -1 };
+static NeoPico * dmaOwners[NUM_DMA_CHANNELS] = {};
+static bool dmaHandlerAdded = false;
+
 NeoPico::NeoPico(){
 }
 
@@ -21,47 +35,99 @@ LEDFormat NeoPico::GetFormat() {
   return format;
 }
 
-void NeoPico::PutPixel(uint32_t pixelData) {
-  switch (format) {
-    case LED_FORMAT_GRB:
-    case LED_FORMAT_RGB:
-      pio_sm_put_blocking(pio, stateMachine, pixelData << 8u);
-      break;
-    case LED_FORMAT_GRBW:
-    case LED_FORMAT_RGBW:
-      pio_sm_put_blocking(pio, stateMachine, pixelData);
-      break;
+void NeoPico::dmaHandler() {
+  for (uint i = 0; i < NUM_DMA_CHANNELS; i++) {
+    if (dmaOwners[i] != nullptr && dma_irqn_get_channel_status(NEOPICO_DMA_IRQ - DMA_IRQ_0, i)) {
+      dma_irqn_acknowledge_channel(NEOPICO_DMA_IRQ - DMA_IRQ_0, i);
+      dmaOwners[i]->doneUs = time_us_32();
+      dmaOwners[i]->busy = false;
+    }
   }
 }
 
 void NeoPico::Setup(int ledPin, int inNumPixels, LEDFormat inFormat, PIO inPio, int inState){
   format = inFormat;
   pio = inPio;
-  numPixels = inNumPixels;
-  stateMachine = inState;
-  uint offset = pio_add_program(pio, &ws2812_program);
+  numPixels = inNumPixels > NEOPICO_MAX_PIXELS ? NEOPICO_MAX_PIXELS : inNumPixels;
+  stateMachine = (inState == NEOPICO_ANY_SM) ? pio_claim_unused_sm(pio, true) : inState;
+
+  // Every chain on this PIO runs the same program
+  uint pioIndex = pio_get_index(pio);
+  if (programOffset[pioIndex] < 0)
+    programOffset[pioIndex] = pio_add_program(pio, &ws2812_program);
   bool rgbw = (format == LED_FORMAT_GRBW) || (format == LED_FORMAT_RGBW);
-  ws2812_program_init(pio, stateMachine, offset, ledPin, 800000, rgbw);
+  ws2812_program_init(pio, stateMachine, programOffset[pioIndex], ledPin, 800000, rgbw);
+  latchUs = ((NEOPICO_FIFO_WORDS * (rgbw ? 32 : 24) * 5) / 4) + NEOPICO_RESET_US;
+
+  dmaChannel = dma_claim_unused_channel(true);
+  dma_channel_config config = dma_channel_get_default_config(dmaChannel);
+  channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+  channel_config_set_read_increment(&config, true);
+  channel_config_set_write_increment(&config, false);
+  channel_config_set_dreq(&config, pio_get_dreq(pio, stateMachine, true));
+  dma_channel_configure(dmaChannel, &config, &pio->txf[stateMachine], nullptr, 0, false);
+
+  dmaOwners[dmaChannel] = this;
+  dma_irqn_set_channel_enabled(NEOPICO_DMA_IRQ - DMA_IRQ_0, dmaChannel, true);
+  if (!dmaHandlerAdded) {
+    irq_add_shared_handler(NEOPICO_DMA_IRQ, &NeoPico::dmaHandler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(NEOPICO_DMA_IRQ, true);
+    dmaHandlerAdded = true;
+  }
+
   this->Clear();
 }
 
 void NeoPico::Clear() {
-  memset(frame, 0, sizeof(frame));
+  memset(frame[back], 0, sizeof(frame[back]));
 }
 
 void NeoPico::SetFrame(uint32_t * newFrame) {
-  memcpy(frame, newFrame, sizeof(frame));
+  // 24 bit formats go out of the top of the word
+  uint32_t * buffer = frame[back];
+  if (format == LED_FORMAT_GRB || format == LED_FORMAT_RGB) {
+    for (int i = 0; i < numPixels; ++i) {
+      buffer[i] = newFrame[i] << 8u;
+    }
+  } else {
+    memcpy(buffer, newFrame, numPixels * sizeof(uint32_t));
+  }
+}
+
+bool NeoPico::IsBusy() {
+  return busy || (time_us_32() - doneUs) < latchUs;
+}
+
+void NeoPico::startTransfer() {
+  uint8_t front = back;
+  back ^= 1;
+  pending = false;
+  busy = true;
+  dma_channel_transfer_from_buffer_now(dmaChannel, frame[front], numPixels);
 }
 
 void NeoPico::Show() {
-  for (int i = 0; i < this->numPixels; ++i) {
-     this->PutPixel(this->frame[i]);
+  if (dmaChannel < 0 || numPixels == 0)
+    return;
+
+  pending = true;
+  Update();
+}
+
+void NeoPico::Update() {
+  if (pending && !IsBusy())
+    startTransfer();
+}
+
+void NeoPico::Wait() {
+  while (IsBusy()) {
+    tight_loop_contents();
   }
 }
 
 void NeoPico::Off() {
+  Wait();
   Clear();
-  for (int i = 0; i < this->numPixels; ++i) {
-     this->PutPixel(this->frame[i]);
-  }
+  Show();
+  Wait();
 }
@@ -4,6 +4,11 @@
 #include "ws2812.pio.h"
 #include <vector>
 
+#define NEOPICO_MAX_PIXELS 100
+
+// Pass as the state machine to Setup to claim whichever one is free
+#define NEOPICO_ANY_SM -1
+
 typedef enum
 {
   LED_FORMAT_GRB = 0,
@@ -12,23 +17,42 @@ typedef enum
   LED_FORMAT_RGBW = 3,
 } LEDFormat;
 
+/**
+ * One WS2812 chain on its own PIO state machine, fed by DMA.
+ *
+ * SetFrame fills the back buffer and Show hands it to a DMA channel and returns right away, the
+ * completion IRQ marks the chain idle again. If the previous frame is still going out (or latching)
+ * when Show is called, the new frame waits in the back buffer until Update finds the chain free. Chains on the same
+ * PIO share one copy of the program.
+ */
 class NeoPico
 {
 public:
   NeoPico();
   void Setup(int ledPin, int inNumPixels, LEDFormat inFormat, PIO inPio, int inState);
   void Show();
+  void Update(); // send a frame Show had to hold back, once the chain is free
   void Clear();
   void Off();
+  void Wait(); // block until the last frame has gone out and latched
+  bool IsBusy();
   LEDFormat GetFormat();
   void SetFrame(uint32_t * newFrame);
 private:
-  void PutPixel(uint32_t pixel_grb);
+  static void dmaHandler();
+  void startTransfer();
+
   LEDFormat format;
   PIO pio = pio1;
   int stateMachine = 0;
   int numPixels = 0;
-  uint32_t frame[100];
+  int dmaChannel = -1;
+  uint32_t latchUs = 0;             // FIFO drain plus reset time after the DMA is done
+  volatile bool busy = false;       // DMA still feeding the FIFO
+  volatile uint32_t doneUs = 0;     // when it stopped
+  bool pending = false;             // back buffer has a frame that hasn't been shown
+  uint8_t back = 0;
+  uint32_t frame[2][NEOPICO_MAX_PIXELS]; // already shifted into PIO FIFO words
 };
 
 #endif
@@ -40,14 +40,203 @@ void PeripheralI2C::setup() {
     gpio_pull_up(_SDA);
     gpio_pull_up(_SCL);
 
+    setupAsync();
+
     // reset the bus before using it
     clear();
 }
 
+void PeripheralI2C::setupAsync() {
+    if (!critical_section_is_initialized(&_lock)) {
+        critical_section_init(&_lock);
+    }
+
+    // without DMA channels to spare, async transactions run blocking when they're submitted
+    if (_dmaTxChannel < 0) {
+        _dmaTxChannel = dma_claim_unused_channel(false);
+        _dmaRxChannel = (_dmaTxChannel >= 0) ? dma_claim_unused_channel(false) : -1;
+        if ((_dmaTxChannel >= 0) && (_dmaRxChannel < 0)) {
+            dma_channel_unclaim(_dmaTxChannel);
+            _dmaTxChannel = -1;
+        }
+    }
+    if (_dmaTxChannel < 0) return;
+
+    i2c_hw_t *hw = i2c_get_hw(_I2C);
+    hw->dma_cr = I2C_IC_DMA_CR_TDMAE_BITS | I2C_IC_DMA_CR_RDMAE_BITS;
+
+    dma_channel_config txConfig = dma_channel_get_default_config(_dmaTxChannel);
+    channel_config_set_transfer_data_size(&txConfig, DMA_SIZE_16);
+    channel_config_set_dreq(&txConfig, i2c_get_dreq(_I2C, true));
+    channel_config_set_read_increment(&txConfig, true);
+    channel_config_set_write_increment(&txConfig, false);
+    dma_channel_configure(_dmaTxChannel, &txConfig, &hw->data_cmd, _commands, 0, false);
+
+    dma_channel_config rxConfig = dma_channel_get_default_config(_dmaRxChannel);
+    channel_config_set_transfer_data_size(&rxConfig, DMA_SIZE_8);
+    channel_config_set_dreq(&rxConfig, i2c_get_dreq(_I2C, false));
+    channel_config_set_read_increment(&rxConfig, false);
+    channel_config_set_write_increment(&rxConfig, true);
+    dma_channel_configure(_dmaRxChannel, &rxConfig, nullptr, &hw->data_cmd, 0, false);
+}
+
+bool PeripheralI2C::submit(I2CTransaction *transaction) {
+    if ((_exclusiveAddress > -1) && (_exclusiveAddress != transaction->address)) return false;
+    if (transaction->isPending()) return false;
+    if ((transaction->writeLength + transaction->readLength) == 0) return false;
+    if ((transaction->writeLength + transaction->readLength) > I2C_ASYNC_MAX_LENGTH) return false;
+    if (!critical_section_is_initialized(&_lock)) return false;
+
+    if (_dmaTxChannel < 0) {
+        // no DMA, do it now
+        claimBus();
+        int16_t result = transaction->writeLength;
+        if (transaction->writeLength > 0) {
+            result = i2c_write_blocking(_I2C, transaction->address, transaction->writeData, transaction->writeLength, transaction->readLength > 0);
+        }
+        if ((result >= 0) && (transaction->readLength > 0)) {
+            result = i2c_read_blocking(_I2C, transaction->address, transaction->readData, transaction->readLength, false);
+        }
+        releaseBus();
+        transaction->result = result;
+        transaction->status = (result >= 0) ? I2C_TRANSACTION_DONE : I2C_TRANSACTION_ERROR;
+        if (transaction->callback != nullptr) transaction->callback(transaction);
+        return true;
+    }
+
+    critical_section_enter_blocking(&_lock);
+    if (_queueCount == I2C_ASYNC_QUEUE_SIZE) {
+        critical_section_exit(&_lock);
+        return false;
+    }
+    transaction->status = I2C_TRANSACTION_QUEUED;
+    _queue[_queueCount++] = transaction;
+    critical_section_exit(&_lock);
+
+    service();
+    return true;
+}
+
+void PeripheralI2C::service() {
+    if (_dmaTxChannel < 0) return;
+
+    critical_section_enter_blocking(&_lock);
+    if (_active != nullptr) {
+        i2c_hw_t *hw = i2c_get_hw(_I2C);
+        uint32_t status = hw->raw_intr_stat;
+        if (status & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS) {
+            // no ACK or lost arbitration, the controller flushes its FIFO and sends a stop by itself
+            dma_channel_abort(_dmaTxChannel);
+            dma_channel_abort(_dmaRxChannel);
+            if (status & I2C_IC_RAW_INTR_STAT_STOP_DET_BITS) {
+                hw->clr_tx_abrt;
+                hw->clr_stop_det;
+                finish(PICO_ERROR_GENERIC);
+            }
+        } else if ((status & I2C_IC_RAW_INTR_STAT_STOP_DET_BITS) && !dma_channel_is_busy(_dmaRxChannel)) {
+            hw->clr_stop_det;
+            finish(_active->writeLength + _active->readLength);
+        } else if (time_reached(_activeTimeout)) {
+            // stuck, abort and pick it up as a TX_ABRT next time around
+            hw->enable |= I2C_IC_ENABLE_ABORT_BITS;
+            _activeTimeout = make_timeout_time_us(I2C_ASYNC_TIMEOUT_US);
+        }
+    }
+    if ((_active == nullptr) && !_claimed && (_queueCount > 0)) {
+        startNext();
+    }
+    critical_section_exit(&_lock);
+}
+
+// called with the lock held
+void PeripheralI2C::finish(int16_t result) {
+    I2CTransaction *transaction = _active;
+    _active = nullptr;
+    transaction->result = result;
+    transaction->status = (result >= 0) ? I2C_TRANSACTION_DONE : I2C_TRANSACTION_ERROR;
+    if (transaction->callback != nullptr) transaction->callback(transaction);
+}
+
+// called with the lock held
+void PeripheralI2C::startNext() {
+    // highest priority first, oldest first within a priority
+    uint8_t next = 0;
+    for (uint8_t i = 1; i < _queueCount; i++) {
+        if (_queue[i]->priority > _queue[next]->priority) next = i;
+    }
+    _active = _queue[next];
+    for (uint8_t i = next; i < (_queueCount - 1); i++) {
+        _queue[i] = _queue[i + 1];
+    }
+    _queueCount--;
+
+    I2CTransaction *transaction = _active;
+    uint16_t count = 0;
+    for (uint16_t i = 0; i < transaction->writeLength; i++) {
+        uint16_t command = transaction->writeData[i];
+        if ((i == (transaction->writeLength - 1)) && (transaction->readLength == 0)) command |= I2C_IC_DATA_CMD_STOP_BITS;
+        _commands[count++] = command;
+    }
+    for (uint16_t i = 0; i < transaction->readLength; i++) {
+        uint16_t command = I2C_IC_DATA_CMD_CMD_BITS;
+        if ((i == 0) && (transaction->writeLength > 0)) command |= I2C_IC_DATA_CMD_RESTART_BITS;
+        if (i == (transaction->readLength - 1)) command |= I2C_IC_DATA_CMD_STOP_BITS;
+        _commands[count++] = command;
+    }
+
+    i2c_hw_t *hw = i2c_get_hw(_I2C);
+    hw->enable = 0;
+    hw->tar = transaction->address;
+    hw->enable = 1;
+    hw->clr_tx_abrt;
+    hw->clr_stop_det;
+
+    transaction->status = I2C_TRANSACTION_ACTIVE;
+    _activeTimeout = make_timeout_time_us(I2C_ASYNC_TIMEOUT_US);
+    if (transaction->readLength > 0) {
+        dma_channel_set_write_addr(_dmaRxChannel, transaction->readData, false);
+        dma_channel_set_trans_count(_dmaRxChannel, transaction->readLength, true);
+    }
+    dma_channel_set_read_addr(_dmaTxChannel, _commands, false);
+    dma_channel_set_trans_count(_dmaTxChannel, count, true);
+}
+
+void PeripheralI2C::flush() {
+    while ((_active != nullptr) || (_queueCount > 0)) {
+        service();
+    }
+}
+
+// Blocking calls wait for the running transaction and keep new ones from starting until they're done
+void PeripheralI2C::claimBus() {
+    if (!critical_section_is_initialized(&_lock)) return;
+
+    while (true) {
+        service();
+        critical_section_enter_blocking(&_lock);
+        if ((_active == nullptr) && !_claimed) {
+            _claimed = true;
+            critical_section_exit(&_lock);
+            return;
+        }
+        critical_section_exit(&_lock);
+    }
+}
+
+void PeripheralI2C::releaseBus() {
+    if (!critical_section_is_initialized(&_lock)) return;
+
+    critical_section_enter_blocking(&_lock);
+    _claimed = false;
+    critical_section_exit(&_lock);
+}
+
 int16_t PeripheralI2C::read(uint8_t address, uint8_t *data, uint16_t len, bool isBlock) {
     if ((_exclusiveAddress > -1) && (_exclusiveAddress != address)) return -1;
 
+    claimBus();
     int16_t result = i2c_read_blocking(_I2C, address, data, len, isBlock);
+    releaseBus();
 #ifdef DEBUG_PERIPHERALI2C
     printf("PeripheralI2C::write %d:%d (blocking? %d)\n", address, len, isBlock);
     for (int i = 0; i < len; i++) {
@@ -63,10 +252,12 @@ int16_t PeripheralI2C::readRegister(uint8_t address, uint8_t reg, uint8_t *data,
     if ((_exclusiveAddress > -1) && (_exclusiveAddress != address)) return -1;
 
     int16_t registerCheck;
+    claimBus();
     registerCheck = i2c_write_blocking(_I2C, address, &reg, 1, true);
     if (registerCheck >= 0) {
         registerCheck = i2c_read_blocking(_I2C, address, data, len, false);
     }
+    releaseBus();
     return (registerCheck >= 0);
 }
 
@@ -79,7 +270,9 @@ int16_t PeripheralI2C::write(uint8_t address, uint8_t *data, uint16_t len, bool
         printf("%02x ", data[i]);
     }
 #endif
+    claimBus();
     int16_t result = i2c_write_blocking(_I2C, address, data, len, isBlock);
+    releaseBus();
 #ifdef DEBUG_PERIPHERALI2C
     printf("\nResult: %d\n", result);
     printf("-----\n");
@@ -93,7 +286,9 @@ uint8_t PeripheralI2C::test(uint8_t address) {
     // TODO: Revert to i2c_read_blocking when we have I2C resolved
     // int16_t ret = i2c_read_blocking(_I2C, address, &data, 1, false);
     absolute_time_t test_timeout = make_timeout_time_ms(100);
+    claimBus();
     int16_t ret = i2c_read_blocking_until(_I2C, address, &data, 1, false, test_timeout);
+    releaseBus();
     return (ret >= 0);
 }
 
@@ -105,6 +300,7 @@ void PeripheralI2C::clear() {
 std::map<uint8_t,bool> PeripheralI2C::scan() {
     std::map<uint8_t,bool> result;
 
+    claimBus();
     for (uint8_t addr = 0; addr < (1 << 7); ++addr) {
         int8_t ret;
         uint8_t rxdata;
@@ -114,6 +310,7 @@ std::map<uint8_t,bool> PeripheralI2C::scan() {
             result.insert({addr,(ret >= 0)});
         }
     }
+    releaseBus();
 
 #ifdef DEBUG_PERIPHERALI2C
     printf("%d\n", result.size());
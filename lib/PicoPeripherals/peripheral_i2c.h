@@ -2,9 +2,11 @@
 #define _PERIPHERAL_I2C_H_
 
 #include <map>
+#include <hardware/dma.h>
 #include <hardware/gpio.h>
 #include <hardware/i2c.h>
 #include <hardware/platform_defs.h>
+#include <pico/critical_section.h>
 
 //#define DEBUG_PERIPHERALI2C
 
@@ -40,6 +42,55 @@
 #define I2C1_SPEED 400000
 #endif
 
+// Longest async transaction (write and read bytes together)
+#ifndef I2C_ASYNC_MAX_LENGTH
+#define I2C_ASYNC_MAX_LENGTH 32
+#endif
+
+#ifndef I2C_ASYNC_QUEUE_SIZE
+#define I2C_ASYNC_QUEUE_SIZE 8
+#endif
+
+// An async transaction that takes longer than this is aborted
+#ifndef I2C_ASYNC_TIMEOUT_US
+#define I2C_ASYNC_TIMEOUT_US 10000
+#endif
+
+typedef enum {
+    I2C_TRANSACTION_IDLE,
+    I2C_TRANSACTION_QUEUED,
+    I2C_TRANSACTION_ACTIVE,
+    I2C_TRANSACTION_DONE,
+    I2C_TRANSACTION_ERROR,
+} I2CTransactionStatus;
+
+struct I2CTransaction;
+typedef void (*I2CTransactionCallback)(I2CTransaction *transaction);
+
+/**
+ * @brief A write, a read, or a write followed by a repeated start and a read, run in the background.
+ *
+ * The transaction and its buffers belong to the caller and have to stay valid until the status is
+ * DONE or ERROR. The callback runs from whichever core services the bus when it finishes, with the
+ * bus locked, so keep it short and don't submit from it; polling status from the owner's own loop is
+ * usually simpler.
+ */
+struct I2CTransaction {
+    uint8_t address = 0;
+    const uint8_t *writeData = nullptr;
+    uint16_t writeLength = 0;
+    uint8_t *readData = nullptr;
+    uint16_t readLength = 0;
+    uint8_t priority = 0; // higher goes first
+    I2CTransactionCallback callback = nullptr;
+    void *context = nullptr;
+
+    volatile I2CTransactionStatus status = I2C_TRANSACTION_IDLE;
+    int16_t result = 0; // bytes transferred, or a PICO_ERROR_* code
+
+    bool isPending() const { return (status == I2C_TRANSACTION_QUEUED) || (status == I2C_TRANSACTION_ACTIVE); }
+};
+
 class PeripheralI2C {
 public:
     PeripheralI2C();
@@ -59,6 +110,15 @@ public:
     uint8_t test(uint8_t address);
     void clear();
 
+    // Queue a transaction to run in the background, false if it can't be queued
+    bool submit(I2CTransaction *transaction);
+
+    // Finish the running transaction if it's done and start the next one, call it from the loop
+    void service();
+
+    // Wait for everything queued to finish
+    void flush();
+
     std::map<uint8_t,bool> scan();
 
     // if this is set to anything other than -1, any r/w operations against the address other than test()/scan() will not be processed
@@ -75,7 +135,23 @@ private:
 
     int8_t _exclusiveAddress = -1;
 
+    critical_section_t _lock = {};
+    int _dmaTxChannel = -1;
+    int _dmaRxChannel = -1;
+    I2CTransaction *_queue[I2C_ASYNC_QUEUE_SIZE] = {};
+    uint8_t _queueCount = 0;
+    I2CTransaction *_active = nullptr;
+    absolute_time_t _activeTimeout;
+    bool _claimed = false;
+    // I2C data/command words for the running transaction, the stop and restart flags travel with the data
+    uint16_t _commands[I2C_ASYNC_MAX_LENGTH];
+
     void setup();
+    void setupAsync();
+    void startNext();
+    void finish(int16_t result);
+    void claimBus();
+    void releaseBus();
 };
 
 #endif
@@ -1,5 +1,7 @@
 #include "peripheral_usb.h"
 
+#include <hardware/dma.h>
+
 PeripheralUSB::PeripheralUSB() {
     _DP = USB_PERIPHERAL_PIN_DPLUS;
     _Enable5v = USB_PERIPHERAL_PIN_5V;
@@ -31,5 +33,9 @@ void PeripheralUSB::setup() {
         pio_cfg.pinout = (_Order == 0 ? PIO_USB_PINOUT_DPDM : PIO_USB_PINOUT_DMDP);
         pio_cfg.sm_tx = 1; // Move TX to PIO0:1, NeoPico is in PIO0:0
         // RX and EOP are PIO1:0, PIO1:1
+
+        // PIO-USB sends from this DMA channel without claiming it, and the default is channel 0.
+        // Take one here, before the I2C blocks, NeoPico and the ADC sampler claim theirs.
+        pio_cfg.tx_ch = dma_claim_unused_channel(true);
     }
 }
\ No newline at end of file
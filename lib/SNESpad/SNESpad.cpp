@@ -31,6 +31,7 @@
 #else
     #include <cstring>
     #include <cstdio>
+    #include "snes_pad.pio.h"
 #endif
 
 SNESpad::SNESpad(int clock, int latch, int data) {
@@ -46,6 +47,58 @@ void SNESpad::begin() {
 #endif
 }
 
+#ifndef ARDUINO
+bool SNESpad::begin(PIO inPio, uint32_t intervalUs) {
+    int sm = pio_claim_unused_sm(inPio, false);
+    if (sm < 0 || !pio_can_add_program(inPio, &snes_pad_program)) {
+        if (sm >= 0)
+            pio_sm_unclaim(inPio, sm);
+        begin();
+        return false;
+    }
+
+    pio = inPio;
+    pioStateMachine = sm;
+    uint offset = pio_add_program(pio, &snes_pad_program);
+
+    gpio_init(dataPin);
+    gpio_set_dir(dataPin, GPIO_IN);
+    gpio_pull_up(dataPin);
+
+    uint32_t idleCycles = (intervalUs > snes_pad_CYCLES_PER_READ) ? (intervalUs - snes_pad_CYCLES_PER_READ) : 0;
+    snes_pad_program_init(pio, pioStateMachine, offset, clockPin, latchPin, dataPin, idleCycles);
+
+#if SNES_PAD_DEBUG==true
+    printf("SNESpad::begin PIO%d SM%d\n", pio_get_index(pio), pioStateMachine);
+#endif
+    return true;
+}
+
+// Take the newest whole read off the RX FIFO, false if there's nothing new
+bool SNESpad::fetch(bool wait) {
+    // Reads are two words, an odd level means the state machine is halfway through pushing one
+    uint level;
+    while ((level = (pio_sm_get_rx_fifo_level(pio, pioStateMachine) & ~1u)) == 0) {
+        if (!wait)
+            return false;
+        tight_loop_contents();
+    }
+
+    for (; level > 0; level -= 2) {
+        pioStatus = pio_sm_get(pio, pioStateMachine);
+        pioData = pio_sm_get(pio, pioStateMachine);
+
+        // the speed clock may have gone out with a read that's being skipped
+        if (!(pioStatus & 0b10)) {
+            pioSpeedClocked = true;
+            pioSpeedRequested = false;
+        }
+    }
+    pioUnread = true;
+    return true;
+}
+#endif
+
 void SNESpad::start() {
 #if SNES_PAD_DEBUG==true
     printf("SNESpad::start\n");
@@ -53,6 +106,12 @@ void SNESpad::start() {
 
     type = SNES_PAD_NONE;
 
+#ifndef ARDUINO
+    // right after begin() the state machine may not have finished its first read
+    if (pio != nullptr && !pioUnread)
+        fetch(true);
+#endif
+
 #if SNES_PAD_DEBUG==true
     uint32_t packet = read();
     // printf("Data Packet: %02x\n",packet);
@@ -95,6 +154,12 @@ void SNESpad::poll() {
     //printf("SNESpad::poll\n");
 #endif
 
+#ifndef ARDUINO
+    // nothing changed since the last poll
+    if (pio != nullptr && !fetch(false) && !pioUnread)
+        return;
+#endif
+
     if (type != SNES_PAD_NONE) {
         state = read(); // polls current controller state
 
@@ -169,6 +234,10 @@ void SNESpad::poll() {
     } else {
         start();
     }
+
+#ifndef ARDUINO
+    pioUnread = false;
+#endif
 }
 
 // init gpio pins
@@ -195,14 +264,18 @@ void SNESpad::init() {
     return;
 }
 
-// signal mouse to go to next speed if not at desired speed
-void SNESpad::speed()
+// default mouse to fastest speed
+bool SNESpad::wantsSpeedChange()
 {
-    // default mouse to fastest speed
-    if (type == SNES_PAD_MOUSE
+    return type == SNES_PAD_MOUSE
         && mouseSpeed != SNES_MOUSE_FAST
-        && mouseSpeedFails < SNES_MOUSE_THRESHOLD
-    ) {
+        && mouseSpeedFails < SNES_MOUSE_THRESHOLD;
+}
+
+// signal mouse to go to next speed if not at desired speed
+bool SNESpad::speed()
+{
+    if (wantsSpeedChange()) {
 #ifdef ARDUINO
         digitalWrite(clockPin,LOW);
         delayMicroseconds(6);
@@ -216,7 +289,9 @@ void SNESpad::speed()
         gpio_put(clockPin,1);
         busy_wait_us(12);
 #endif
+        return true;
     }
+    return false;
 }
 
 // clock in a data bit
@@ -244,14 +319,15 @@ uint32_t SNESpad::clock()
     return ret;
 }
 
-// latch to start read
-void SNESpad::latch()
+// latch to start read, returns true if the mouse speed was clocked
+bool SNESpad::latch()
 {
+    bool speedClocked;
 #ifdef ARDUINO
     digitalWrite(latchPin,HIGH);
     delayMicroseconds(12);
 
-    speed();
+    speedClocked = speed();
 
     digitalWrite(latchPin,LOW);
     delayMicroseconds(6);
@@ -259,11 +335,12 @@ void SNESpad::latch()
     gpio_put(latchPin,1);
     busy_wait_us(12);
 
-    speed(); // check/set mouse speed
+    speedClocked = speed(); // check/set mouse speed
 
     gpio_put(latchPin,0);
     busy_wait_us(6);
 #endif
+    return speedClocked;
 }
 
 uint32_t SNESpad::read()
@@ -271,6 +348,23 @@ uint32_t SNESpad::read()
     uint32_t ret = 0;
     uint8_t i;
 
+#ifndef ARDUINO
+    if (pio != nullptr) {
+        ret = pioData;
+        if (ret & (1 << 15)) ret &= 0xFFFF; // not a mouse, ignore the extra bits like below
+
+        ret = identify(~ret, pioStatus & 0b01, pioSpeedClocked);
+        pioSpeedClocked = false;
+
+        // goes out during the next latch
+        if (wantsSpeedChange() && !pioSpeedRequested) {
+            pio_sm_put(pio, pioStateMachine, 0);
+            pioSpeedRequested = true;
+        }
+        return ret;
+    }
+#endif
+
     /* A connected device will pull the data line low prior to latch.
        A disconnected pin is kept high by internal pull_up.*/
     uint32_t disconnected = false;
@@ -280,7 +374,7 @@ uint32_t SNESpad::read()
     disconnected = gpio_get(dataPin);
 #endif
 
-    latch();
+    bool speedClocked = latch();
     for (i = 0; i < 32; i++) {
         uint32_t bit = clock(); // clock shift bit in 
         ret |= bit << i;
@@ -297,6 +391,12 @@ uint32_t SNESpad::read()
     }
     ret = ~ret; // buttons are active low, so invert bits
 
+    return identify(ret, disconnected, speedClocked);
+}
+
+// work out the device type from a read, returns 0 if nothing is connected
+uint32_t SNESpad::identify(uint32_t ret, bool disconnected, bool speedClocked)
+{
     // verify controller or mouse is connected
     if (disconnected && !(ret & 0xFFFF)) {
         type = SNES_PAD_NONE;
@@ -324,7 +424,8 @@ uint32_t SNESpad::read()
 
         // detect hyperkin mouse failure to change speed to halt further attempts
         if (
-            mouseSpeed != SNES_MOUSE_FAST
+            speedClocked
+            && mouseSpeed != SNES_MOUSE_FAST
             && lastMouseSpeed == mouseSpeed
             && mouseSpeedFails < SNES_MOUSE_THRESHOLD
         ) {
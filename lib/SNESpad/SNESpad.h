@@ -34,6 +34,7 @@
 #else
     // If we aren't compiling on Arduino, include the Pico SDK standard library
     #include "pico/stdlib.h"
+    #include "hardware/pio.h"
 #endif
 
 #define SNES_PAD_NONE   -1
@@ -74,6 +75,10 @@
 #define SNES_PAD_DEBUG false
 #endif
 
+#ifndef SNES_PAD_PIO_INTERVAL_US
+#define SNES_PAD_PIO_INTERVAL_US 1000 // time between reads when a PIO state machine does them
+#endif
+
 class SNESpad {
   protected:
   // uint8_t address;
@@ -102,6 +107,12 @@ class SNESpad {
 
     // Methods
     void begin();
+#ifndef ARDUINO
+    // Have a state machine on inPio read the pad every intervalUs in the background, poll() then
+    // only picks up the latest read. Falls back to begin() if inPio has no state machine or program
+    // space left.
+    bool begin(PIO inPio, uint32_t intervalUs = SNES_PAD_PIO_INTERVAL_US);
+#endif
     void start();
     void poll();
   private:
@@ -113,10 +124,24 @@ class SNESpad {
     uint8_t mouseSpeedFails = 0;
     uint32_t _lastRead;
 
+#ifndef ARDUINO
+    PIO pio = nullptr;
+    uint pioStateMachine;
+    uint32_t pioStatus;             // first word of the latest read, see snes_pad.pio
+    uint32_t pioData;               // second word, the data bits
+    bool pioUnread = false;         // latest read hasn't been through poll() yet
+    bool pioSpeedRequested = false; // asked for a speed clock that hasn't gone out yet
+    bool pioSpeedClocked = false;   // it went out since the last read()
+
+    bool fetch(bool wait);
+#endif
+
     void init();
-    void speed();
-    void latch();
+    bool wantsSpeedChange();
+    bool speed();
+    bool latch();
     uint32_t read();
+    uint32_t identify(uint32_t packet, bool disconnected, bool speedClocked);
     uint32_t clock();
     uint8_t reverse(uint8_t c);
 };
@@ -207,6 +207,40 @@ void WiiExtension::start() {
     }
 }
 
+uint8_t WiiExtension::getReportLength() {
+    switch (dataType) {
+        case WII_DATA_TYPE_1:
+            return 6;
+        case WII_DATA_TYPE_2:
+            return 9;
+        case WII_DATA_TYPE_3:
+            return 8;
+        // Motion Plus data types
+        case WII_DATA_TYPE_4:
+        case WII_DATA_TYPE_5:
+        case WII_DATA_TYPE_6:
+        case WII_DATA_TYPE_7:
+            return 16;
+        default:
+            // unknown. TBD
+#if WII_EXTENSION_DEBUG==true
+            printf("WiiExtension::poll Unknown data type: %1d\n", dataType);
+#endif
+            return 0;
+    }
+}
+
+void WiiExtension::decode(uint8_t *pData, int iLen) {
+    extensionController->process(pData);
+    if (!extensionController->skipPostProcess) extensionController->postProcess();
+
+#if WII_EXTENSION_DEBUG==true
+    for (int i = 0; i < iLen; ++i) {
+        _lastRead[i] = pData[i];
+    }
+#endif
+}
+
 void WiiExtension::poll() {
     uint8_t regWrite[16];
     uint8_t regRead[16];
@@ -220,41 +254,11 @@ void WiiExtension::poll() {
     if (!isReady) return;
 
     if (extensionType != WII_EXTENSION_NONE) {
-        switch (dataType) {
-            case WII_DATA_TYPE_1:
-                result = doI2CRead(regRead, 6);
-                break;
-            case WII_DATA_TYPE_2:
-                result = doI2CRead(regRead, 9);
-                break;
-            case WII_DATA_TYPE_3:
-                result = doI2CRead(regRead, 8);
-                break;
-            // Motion Plus data types
-            case WII_DATA_TYPE_4:
-            case WII_DATA_TYPE_5:
-            case WII_DATA_TYPE_6:
-            case WII_DATA_TYPE_7:
-                result = doI2CRead(regRead, 16);
-                break;
-            default:
-                // unknown. TBD
-                result = -1;
-#if WII_EXTENSION_DEBUG==true
-                printf("WiiExtension::poll Unknown data type: %1d\n", dataType);
-#endif
-                break;
-        }
+        uint8_t reportLength = getReportLength();
+        result = (reportLength > 0) ? doI2CRead(regRead, reportLength) : -1;
 
         if (result > 0) {
-            extensionController->process(regRead);
-            if (!extensionController->skipPostProcess) extensionController->postProcess();
-
-#if WII_EXTENSION_DEBUG==true
-            for (int i = 0; i < result; ++i) {
-                _lastRead[i] = regRead[i];
-            }
-#endif
+            decode(regRead, result);
 
             if (extensionType == WII_EXTENSION_TURNTABLE) {
                 regWrite[0] = 0xFB;
@@ -277,8 +281,90 @@ void WiiExtension::poll() {
     }
 }
 
+bool WiiExtension::submitPoll(uint8_t *pWrite, uint16_t iWriteLen, uint8_t *pRead, uint16_t iReadLen) {
+    pollTransaction.address = address;
+    pollTransaction.writeData = pWrite;
+    pollTransaction.writeLength = iWriteLen;
+    pollTransaction.readData = pRead;
+    pollTransaction.readLength = iReadLen;
+    return i2c->submit(&pollTransaction);
+}
+
+// Same sequence as poll(), one step per call. The extension still needs WII_EXTENSION_DELAY between
+// transactions, that is now spent running the rest of the loop instead of spinning on the alarm.
+bool WiiExtension::service() {
+    if (!isReady) return false;
+
+    if (extensionType == WII_EXTENSION_NONE) {
+        reset();
+        start();
+        return false;
+    }
+
+    if (pollTransaction.isPending()) {
+        i2c->service();
+        if (pollTransaction.isPending()) return false;
+    }
+
+    switch (pollState) {
+        case WII_POLL_IDLE:
+            if (time_reached(pollReadyAt)) {
+                uint8_t reportLength = getReportLength();
+                if (reportLength == 0) {
+                    extensionType = WII_EXTENSION_NONE;
+                    reset();
+                    start();
+                } else if (submitPoll(nullptr, 0, pollRead, reportLength)) {
+                    pollState = WII_POLL_READ;
+                }
+            }
+            return false;
+        case WII_POLL_READ:
+            pollReadyAt = make_timeout_time_us(WII_EXTENSION_DELAY);
+            if (pollTransaction.status != I2C_TRANSACTION_DONE) {
+                // device disconnected or invalid read
+                extensionType = WII_EXTENSION_NONE;
+                reset();
+                start();
+                return false;
+            }
+#if WII_EXTENSION_ENCRYPTION==true
+            for (int i = 0; i < pollTransaction.readLength; ++i) {
+                pollRead[i] = WII_DECRYPT_BYTE(pollRead[i]);
+            }
+#endif
+            decode(pollRead, pollTransaction.readLength);
+            pollState = (extensionType == WII_EXTENSION_TURNTABLE) ? WII_POLL_LED : WII_POLL_CONTINUE;
+            return true;
+        case WII_POLL_LED:
+            if (time_reached(pollReadyAt)) {
+                pollWrite[0] = 0xFB;
+                pollWrite[1] = ((TurntableExtension*)extensionController)->getLED();
+                if (submitPoll(pollWrite, 2, nullptr, 0)) pollState = WII_POLL_LED_SENT;
+            }
+            return false;
+        case WII_POLL_LED_SENT:
+            pollReadyAt = make_timeout_time_us(WII_EXTENSION_DELAY);
+            pollState = WII_POLL_CONTINUE;
+            return false;
+        case WII_POLL_CONTINUE:
+            if (time_reached(pollReadyAt)) {
+                pollWrite[0] = 0x00;
+                if (submitPoll(pollWrite, 1, nullptr, 0)) pollState = WII_POLL_CONTINUE_SENT;
+            }
+            return false;
+        case WII_POLL_CONTINUE_SENT:
+            pollReadyAt = make_timeout_time_us(WII_EXTENSION_DELAY);
+            pollState = WII_POLL_IDLE;
+            return false;
+    }
+
+    return false;
+}
+
 void WiiExtension::reset() {
     isReady = false;
+    pollState = WII_POLL_IDLE;
 }
 
 int WiiExtension::doI2CWrite(uint8_t *pData, int iLen) {
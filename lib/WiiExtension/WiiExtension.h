@@ -113,6 +113,16 @@ static volatile bool WiiExtension_alarmFired;
   ((byte) & 0x02 ? '1' : '0'), \
   ((byte) & 0x01 ? '1' : '0') 
 
+// Steps of the background poll, see WiiExtension::service()
+typedef enum {
+    WII_POLL_IDLE,          // waiting to start the next read
+    WII_POLL_READ,          // report read in flight
+    WII_POLL_LED,           // waiting to send the turntable LED state
+    WII_POLL_LED_SENT,
+    WII_POLL_CONTINUE,      // waiting to point the extension back at register 0x00
+    WII_POLL_CONTINUE_SENT,
+} WiiPollState;
+
 #define TOUCH_BETWEEN_RANGE(val,beg,end) (((val) >= ((beg)-WII_GUITAR_TOUCHPAD_OVERLAP)) && ((val) < (end)))
 #define WII_DECRYPT_BYTE(x) (((x) ^ 0x17) + 0x17)
 
@@ -136,6 +146,10 @@ class WiiExtension {
     void start();
     void poll();
 
+    // Non-blocking poll on the async I2C bus, call it every loop. Returns true when a new report
+    // has been decoded into the controller.
+    bool service();
+
     void setI2C(PeripheralI2C *i2cController) { this->i2c = i2cController; }
     void setAddress(uint8_t addr) { this->address = addr; }
 
@@ -147,6 +161,16 @@ class WiiExtension {
     uint8_t _lastRead[16] = {0xFF};
 #endif
 
+    uint8_t getReportLength();
+    void decode(uint8_t *pData, int iLen);
+    bool submitPoll(uint8_t *pWrite, uint16_t iWriteLen, uint8_t *pRead, uint16_t iReadLen);
+
+    WiiPollState pollState = WII_POLL_IDLE;
+    I2CTransaction pollTransaction;
+    absolute_time_t pollReadyAt = nil_time;
+    uint8_t pollRead[16];
+    uint8_t pollWrite[2];
+
     int doI2CWrite(uint8_t *pData, int iLen);
     int doI2CRead(uint8_t *pData, int iLen);
     uint8_t doI2CTest();
@@ -0,0 +1,97 @@
+#include "adcsampler.h"
+
+#include "hardware/adc.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+
+bool ADCSampler::addPin(Pin_t pin) {
+    if (!isADCPin(pin))
+        return false;
+
+    uint8_t channel = pin - ADC_SAMPLER_PIN_OFFSET;
+    if (channelMask & (1 << channel))
+        return true;
+
+    adc_gpio_init(pin);
+    channelMask |= (1 << channel);
+    start();
+    return true;
+}
+
+uint16_t ADCSampler::read(Pin_t pin) {
+    if (!isADCPin(pin))
+        return 0;
+
+    uint8_t channel = pin - ADC_SAMPLER_PIN_OFFSET;
+    if (!(channelMask & (1 << channel)))
+        return 0;
+
+    // only right after start(), before the ring has been filled once
+    while (!time_reached(readyAt))
+        tight_loop_contents();
+
+    uint32_t sum = 0;
+    for (uint16_t i = channelSlot[channel]; i < (channelCount * ADC_SAMPLER_OVERSAMPLE); i += channelCount)
+        sum += ring[i];
+    return (sum + (ADC_SAMPLER_OVERSAMPLE / 2)) / ADC_SAMPLER_OVERSAMPLE;
+}
+
+void ADCSampler::stop() {
+    adc_run(false);
+    if (dataChannel >= 0) {
+        // the control channel can re-trigger the data channel while it's being aborted, so go twice
+        dma_channel_abort(controlChannel);
+        dma_channel_abort(dataChannel);
+        dma_channel_abort(controlChannel);
+        dma_channel_abort(dataChannel);
+    }
+    adc_fifo_drain();
+}
+
+void ADCSampler::start() {
+    stop();
+
+    // Round-robin walks the enabled channels in ascending order, so a channel's slot in each pass is
+    // the number of enabled channels below it
+    channelCount = 0;
+    uint8_t firstChannel = 0;
+    for (uint8_t channel = 0; channel < ADC_SAMPLER_CHANNELS; channel++) {
+        if (channelMask & (1 << channel)) {
+            if (channelCount == 0)
+                firstChannel = channel;
+            channelSlot[channel] = channelCount++;
+        }
+    }
+    if (channelCount == 0)
+        return;
+
+    if (dataChannel < 0) {
+        dataChannel = dma_claim_unused_channel(true);
+        controlChannel = dma_claim_unused_channel(true);
+    }
+
+    adc_select_input(firstChannel);
+    adc_set_round_robin(channelMask);
+    adc_fifo_setup(true, true, 1, false, false);
+    adc_set_clkdiv((clock_get_hz(clk_adc) / ADC_SAMPLER_RATE) - 1);
+
+    dma_channel_config dataConfig = dma_channel_get_default_config(dataChannel);
+    channel_config_set_transfer_data_size(&dataConfig, DMA_SIZE_16);
+    channel_config_set_read_increment(&dataConfig, false);
+    channel_config_set_write_increment(&dataConfig, true);
+    channel_config_set_dreq(&dataConfig, DREQ_ADC);
+    channel_config_set_chain_to(&dataConfig, controlChannel);
+    dma_channel_configure(dataChannel, &dataConfig, ring, &adc_hw->fifo, channelCount * ADC_SAMPLER_OVERSAMPLE, false);
+
+    // Points the data channel back at the start of the ring and triggers it again
+    dma_channel_config controlConfig = dma_channel_get_default_config(controlChannel);
+    channel_config_set_transfer_data_size(&controlConfig, DMA_SIZE_32);
+    channel_config_set_read_increment(&controlConfig, false);
+    channel_config_set_write_increment(&controlConfig, false);
+    dma_channel_configure(controlChannel, &controlConfig, &dma_hw->ch[dataChannel].al2_write_addr_trig, &ringStart, 1, false);
+
+    dma_channel_start(dataChannel);
+    adc_run(true);
+
+    readyAt = make_timeout_time_us(((uint64_t)channelCount * ADC_SAMPLER_OVERSAMPLE * 1000000 / ADC_SAMPLER_RATE) + 100);
+}
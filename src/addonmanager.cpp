@@ -1,11 +1,13 @@
 #include "addonmanager.h"
 #include "usbhostmanager.h"
+#include "perfstats.h"
 
 bool AddonManager::LoadAddon(GPAddon* addon) {
     if (addon->available()) {
         AddonBlock * block = new AddonBlock;
         addon->setup();
         block->ptr = addon;
+        block->perfStage = PerfStats::getInstance().addStage(addon->name().c_str(), 3);
         addons.push_back(block);
         return true;
     } else {
@@ -30,23 +32,32 @@ void AddonManager::ReinitializeAddons() {
 }
 
 void AddonManager::PreprocessAddons() {
+    PerfStats& perfStats = PerfStats::getInstance();
     // Loop through all addons and process any that match our type
     for (std::vector<AddonBlock*>::iterator it = addons.begin(); it != addons.end(); it++) {
+        uint32_t start = PerfStats::now();
         (*it)->ptr->preprocess();
+        perfStats.recordPhase((*it)->perfStage, PERF_PHASE_PREPROCESS, start);
     }
 }
 
 void AddonManager::ProcessAddons() {
+    PerfStats& perfStats = PerfStats::getInstance();
     // Loop through all addons and process any that match our type
     for (std::vector<AddonBlock*>::iterator it = addons.begin(); it != addons.end(); it++) {
+        uint32_t start = PerfStats::now();
         (*it)->ptr->process();
+        perfStats.recordPhase((*it)->perfStage, PERF_PHASE_PROCESS, start);
     }
 }
 
 void AddonManager::PostprocessAddons(bool reportSent) {
+    PerfStats& perfStats = PerfStats::getInstance();
     // Loop through all addons and process any that match our type
     for (std::vector<AddonBlock*>::iterator it = addons.begin(); it != addons.end(); it++) {
+        uint32_t start = PerfStats::now();
         (*it)->ptr->postprocess(reportSent);
+        perfStats.recordPhase((*it)->perfStage, PERF_PHASE_POSTPROCESS, start);
     }
 }
 
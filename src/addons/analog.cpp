@@ -1,18 +1,39 @@
 #include "addons/analog.h"
 #include "config.pb.h"
 #include "enums.pb.h"
-#include "hardware/adc.h"
+#include "adcsampler.h"
 #include "helper.h"
 #include "storagemanager.h"
 #include "drivermanager.h"
 
-#include <math.h>
+#include <algorithm>
 
 #define ADC_MAX ((1 << 12) - 1) // 4095
-#define ADC_PIN_OFFSET 26
-#define ANALOG_MAX 1.0f
-#define ANALOG_CENTER 0.5f
-#define ANALOG_MINIMUM 0.0f
+
+// Everything below is integer, the M0+ has no FPU. Positions carry 24 fractional bits.
+#define ANALOG_SHIFT 24
+#define ANALOG_MAX (1 << ANALOG_SHIFT)
+#define ANALOG_CENTER (1 << (ANALOG_SHIFT - 1))
+#define ANALOG_MINIMUM 0
+
+// Percentages and per mille options to fixed point
+#define ANALOG_FROM_PERCENT(x) ((int32_t)(((int64_t)(x) << ANALOG_SHIFT) / 100))
+
+static uint32_t isqrt64(uint64_t value) {
+    uint64_t result = 0;
+    uint64_t bit = 1ULL << 62;
+    while (bit > value) bit >>= 2;
+    while (bit != 0) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)result;
+}
 
 bool AnalogInput::available() {
     return Storage::getInstance().getAddonOptions().analogOptions.enabled;
@@ -27,10 +48,10 @@ void AnalogInput::setup() {
     adc_pairs[0].analog_invert = analogOptions.analogAdc1Invert;
     adc_pairs[0].analog_dpad = analogOptions.analogAdc1Mode;
     adc_pairs[0].ema_option = analogOptions.analog_smoothing;
-    adc_pairs[0].ema_smoothing = analogOptions.smoothing_factor / 1000.0f;
-    adc_pairs[0].error_rate = analogOptions.analog_error / 1000.0f;
-    adc_pairs[0].in_deadzone = analogOptions.inner_deadzone / 100.0f;
-    adc_pairs[0].out_deadzone = analogOptions.outer_deadzone / 100.0f;
+    adc_pairs[0].ema_smoothing = (int32_t)(analogOptions.smoothing_factor * 65536.0f / 1000.0f + 0.5f);
+    adc_pairs[0].error_rate = analogOptions.analog_error;
+    adc_pairs[0].in_deadzone = ANALOG_FROM_PERCENT(analogOptions.inner_deadzone);
+    adc_pairs[0].out_deadzone = ANALOG_FROM_PERCENT(analogOptions.outer_deadzone);
     adc_pairs[0].auto_calibration = analogOptions.auto_calibrate;
     adc_pairs[0].forced_circularity = analogOptions.forced_circularity;
     adc_pairs[1].x_pin = analogOptions.analogAdc2PinX;
@@ -38,41 +59,44 @@ void AnalogInput::setup() {
     adc_pairs[1].analog_invert = analogOptions.analogAdc2Invert;
     adc_pairs[1].analog_dpad = analogOptions.analogAdc2Mode;
     adc_pairs[1].ema_option = analogOptions.analog_smoothing2;
-    adc_pairs[1].ema_smoothing = analogOptions.smoothing_factor2 / 1000.0f;
-    adc_pairs[1].error_rate = analogOptions.analog_error2 / 1000.0f;
-    adc_pairs[1].in_deadzone = analogOptions.inner_deadzone2 / 100.0f;
-    adc_pairs[1].out_deadzone = analogOptions.outer_deadzone2 / 100.0f;
+    adc_pairs[1].ema_smoothing = (int32_t)(analogOptions.smoothing_factor2 * 65536.0f / 1000.0f + 0.5f);
+    adc_pairs[1].error_rate = analogOptions.analog_error2;
+    adc_pairs[1].in_deadzone = ANALOG_FROM_PERCENT(analogOptions.inner_deadzone2);
+    adc_pairs[1].out_deadzone = ANALOG_FROM_PERCENT(analogOptions.outer_deadzone2);
     adc_pairs[1].auto_calibration = analogOptions.auto_calibrate2;
     adc_pairs[1].forced_circularity = analogOptions.forced_circularity2;
     
 
     // Setup defaults and helpers
     for (int i = 0; i < ADC_COUNT; i++) {
-        adc_pairs[i].x_pin_adc = adc_pairs[i].x_pin - ADC_PIN_OFFSET;
-        adc_pairs[i].y_pin_adc = adc_pairs[i].y_pin - ADC_PIN_OFFSET;
         adc_pairs[i].x_value = ANALOG_CENTER;
         adc_pairs[i].y_value = ANALOG_CENTER;
-        adc_pairs[i].xy_magnitude = 0.0f;
-        adc_pairs[i].x_magnitude = 0.0f;
-        adc_pairs[i].y_magnitude = 0.0f;
-        adc_pairs[i].x_ema = 0.0f;
-        adc_pairs[i].y_ema = 0.0f;
+        adc_pairs[i].xy_magnitude = 0;
+        adc_pairs[i].x_magnitude = 0;
+        adc_pairs[i].y_magnitude = 0;
+        adc_pairs[i].x_ema = 0;
+        adc_pairs[i].y_ema = 0;
     }
 
-    // Intialize and auto center X/Y for each pair
+    // Intialize X/Y for each pair, the ADC samples them in the background from here on
+    ADCSampler& sampler = ADCSampler::getInstance();
     for (int i = 0; i < ADC_COUNT; i++) {
         if(isValidPin(adc_pairs[i].x_pin)) {
-            adc_gpio_init(adc_pairs[i].x_pin);
-            if (adc_pairs[i].auto_calibration) {
-                adc_select_input(adc_pairs[i].x_pin - ADC_PIN_OFFSET);
-                adc_pairs[i].x_center = adc_read();
-            }
+            sampler.addPin(adc_pairs[i].x_pin);
         }
         if(isValidPin(adc_pairs[i].y_pin)) {
-            adc_gpio_init(adc_pairs[i].y_pin);
-            if (adc_pairs[i].auto_calibration) {
-                adc_select_input(adc_pairs[i].y_pin - ADC_PIN_OFFSET);
-                adc_pairs[i].y_center = adc_read();
+            sampler.addPin(adc_pairs[i].y_pin);
+        }
+    }
+
+    // Auto center X/Y once every channel is running
+    for (int i = 0; i < ADC_COUNT; i++) {
+        if (adc_pairs[i].auto_calibration) {
+            if(isValidPin(adc_pairs[i].x_pin)) {
+                adc_pairs[i].x_center = sampler.read(adc_pairs[i].x_pin);
+            }
+            if(isValidPin(adc_pairs[i].y_pin)) {
+                adc_pairs[i].y_center = sampler.read(adc_pairs[i].y_pin);
             }
         }
     }
@@ -89,7 +113,7 @@ void AnalogInput::process() {
     for(int i = 0; i < ADC_COUNT; i++) {
         // Read X-Axis
         if (isValidPin(adc_pairs[i].x_pin)) {
-            adc_pairs[i].x_value = readPin(i, adc_pairs[i].x_pin_adc, adc_pairs[i].x_center);
+            adc_pairs[i].x_value = readPin(i, adc_pairs[i].x_pin, adc_pairs[i].x_center);
             if (adc_pairs[i].analog_invert == InvertMode::INVERT_X || 
                 adc_pairs[i].analog_invert == InvertMode::INVERT_XY) {
                 adc_pairs[i].x_value = ANALOG_MAX - adc_pairs[i].x_value;
@@ -101,7 +125,7 @@ void AnalogInput::process() {
         }
         // Read Y-Axis
         if (isValidPin(adc_pairs[i].y_pin)) {
-            adc_pairs[i].y_value = readPin(i, adc_pairs[i].y_pin_adc, adc_pairs[i].y_center);
+            adc_pairs[i].y_value = readPin(i, adc_pairs[i].y_pin, adc_pairs[i].y_center);
             if (adc_pairs[i].analog_invert == InvertMode::INVERT_Y || 
                 adc_pairs[i].analog_invert == InvertMode::INVERT_XY) {
                 adc_pairs[i].y_value = ANALOG_MAX - adc_pairs[i].y_value;
@@ -121,28 +145,17 @@ void AnalogInput::process() {
         }
 
         if (adc_pairs[i].analog_dpad == DpadMode::DPAD_MODE_LEFT_ANALOG) {
-            if ( joystickMid == 0x8000 ) {
-                gamepad->state.lx = static_cast<uint16_t>(std::ceil(65535.0f * adc_pairs[i].x_value));
-                gamepad->state.ly = static_cast<uint16_t>(std::ceil(65535.0f * adc_pairs[i].y_value));
-            } else { // 0x7FFF
-                gamepad->state.lx = static_cast<uint16_t>(65535.0f * adc_pairs[i].x_value);
-                gamepad->state.ly = static_cast<uint16_t>(65535.0f * adc_pairs[i].y_value);
-            }
+            gamepad->state.lx = toJoystick(adc_pairs[i].x_value, joystickMid == 0x8000);
+            gamepad->state.ly = toJoystick(adc_pairs[i].y_value, joystickMid == 0x8000);
         } else if (adc_pairs[i].analog_dpad == DpadMode::DPAD_MODE_RIGHT_ANALOG) {
-            if ( joystickMid == 0x8000 ) {
-                gamepad->state.rx = static_cast<uint16_t>(std::ceil(65535.0f * adc_pairs[i].x_value));
-                gamepad->state.ry = static_cast<uint16_t>(std::ceil(65535.0f * adc_pairs[i].y_value));
-            } else { // 0x7FFF
-                gamepad->state.rx = static_cast<uint16_t>(65535.0f * adc_pairs[i].x_value);
-                gamepad->state.ry = static_cast<uint16_t>(65535.0f * adc_pairs[i].y_value);
-            }
+            gamepad->state.rx = toJoystick(adc_pairs[i].x_value, joystickMid == 0x8000);
+            gamepad->state.ry = toJoystick(adc_pairs[i].y_value, joystickMid == 0x8000);
         }
     }
 }
 
-float AnalogInput::readPin(int stick_num, Pin_t pin_adc, uint16_t center) {
-    adc_select_input(pin_adc);
-    uint16_t adc_value = adc_read();
+int32_t AnalogInput::readPin(int stick_num, Pin_t pin, uint16_t center) {
+    uint16_t adc_value = ADCSampler::getInstance().read(pin);
     if (adc_pairs[stick_num].auto_calibration) {
         if (adc_value > center) {
             adc_value = map(adc_value, center, ADC_MAX, ADC_MAX / 2, ADC_MAX);
@@ -152,30 +165,59 @@ float AnalogInput::readPin(int stick_num, Pin_t pin_adc, uint16_t center) {
             adc_value = map(adc_value, 0, center, 0, ADC_MAX / 2);
         }
     }
-    return ((float)adc_value) / ADC_MAX;
+    // adc_value / ADC_MAX, as 2^24 / 4095 is 4097.0002 the last term makes up the difference
+    return (adc_value * 4097) + (adc_value >> 11);
 }
 
-float AnalogInput::emaCalculation(int stick_num, float ema_value, float ema_previous) {
-    return (adc_pairs[stick_num].ema_smoothing * ema_value) + ((1.0f - adc_pairs[stick_num].ema_smoothing) * ema_previous);
+int32_t AnalogInput::emaCalculation(int stick_num, int32_t ema_value, int32_t ema_previous) {
+    int64_t delta = (int64_t)(ema_value - ema_previous) * adc_pairs[stick_num].ema_smoothing;
+    return ema_previous + (int32_t)((delta + (1 << 15)) >> 16);
 }
 
 uint16_t AnalogInput::map(uint16_t x, uint16_t in_min, uint16_t in_max, uint16_t out_min, uint16_t out_max) {
     return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
 }
 
-float AnalogInput::magnitudeCalculation(int stick_num, adc_instance & adc_inst) {
+int32_t AnalogInput::magnitudeCalculation(int stick_num, adc_instance & adc_inst) {
     adc_inst.x_magnitude = adc_inst.x_value - ANALOG_CENTER;
     adc_inst.y_magnitude = adc_inst.y_value - ANALOG_CENTER;
-    return adc_pairs[stick_num].error_rate * std::sqrt((adc_inst.x_magnitude * adc_inst.x_magnitude) + (adc_inst.y_magnitude * adc_inst.y_magnitude));
+    uint64_t squared = ((int64_t)adc_inst.x_magnitude * adc_inst.x_magnitude) + ((int64_t)adc_inst.y_magnitude * adc_inst.y_magnitude);
+    return (int32_t)(((uint64_t)isqrt64(squared) * adc_pairs[stick_num].error_rate + 500) / 1000);
 }
 
 void AnalogInput::radialDeadzone(int stick_num, adc_instance & adc_inst) {
-    float scaling_factor = (adc_inst.xy_magnitude - adc_pairs[stick_num].in_deadzone) / (adc_pairs[stick_num].out_deadzone - adc_pairs[stick_num].in_deadzone);
-    if (adc_pairs[stick_num].forced_circularity == true) {
-        scaling_factor = std::fmin(scaling_factor, ANALOG_CENTER);
+    // only reachable with no inner deadzone, there's no direction to scale along
+    if (adc_inst.xy_magnitude <= 0) {
+        adc_inst.x_value = ANALOG_CENTER;
+        adc_inst.y_value = ANALOG_CENTER;
+        return;
+    }
+
+    // Unit vector along the stick, then scaled by how far past the inner deadzone it is
+    int64_t x_unit = ((int64_t)adc_inst.x_magnitude << ANALOG_SHIFT) / adc_inst.xy_magnitude;
+    int64_t y_unit = ((int64_t)adc_inst.y_magnitude << ANALOG_SHIFT) / adc_inst.xy_magnitude;
+    int64_t travel = adc_inst.xy_magnitude - adc_pairs[stick_num].in_deadzone;
+    int64_t range = adc_pairs[stick_num].out_deadzone - adc_pairs[stick_num].in_deadzone;
+
+    int64_t x_offset, y_offset;
+    if (range == 0) {
+        x_offset = (x_unit > 0) ? ANALOG_MAX : ((x_unit < 0) ? -ANALOG_MAX : 0);
+        y_offset = (y_unit > 0) ? ANALOG_MAX : ((y_unit < 0) ? -ANALOG_MAX : 0);
+    } else if ((adc_pairs[stick_num].forced_circularity == true) && ((travel * 2) > range)) {
+        // scaling capped at half
+        x_offset = x_unit / 2;
+        y_offset = y_unit / 2;
+    } else {
+        x_offset = (x_unit * travel) / range;
+        y_offset = (y_unit * travel) / range;
     }
-    adc_inst.x_value = ((adc_inst.x_magnitude / adc_inst.xy_magnitude) * scaling_factor) + ANALOG_CENTER;
-    adc_inst.y_value = ((adc_inst.y_magnitude / adc_inst.xy_magnitude) * scaling_factor) + ANALOG_CENTER;
-    adc_inst.x_value = std::clamp(adc_inst.x_value, ANALOG_MINIMUM, ANALOG_MAX);
-    adc_inst.y_value = std::clamp(adc_inst.y_value, ANALOG_MINIMUM, ANALOG_MAX);
-}
\ No newline at end of file
+    adc_inst.x_value = (int32_t)std::clamp<int64_t>(x_offset + ANALOG_CENTER, ANALOG_MINIMUM, ANALOG_MAX);
+    adc_inst.y_value = (int32_t)std::clamp<int64_t>(y_offset + ANALOG_CENTER, ANALOG_MINIMUM, ANALOG_MAX);
+}
+
+// Scale to the 16-bit joystick range, rounding up for drivers centered on 0x8000
+uint16_t AnalogInput::toJoystick(int32_t value, bool roundUp) {
+    uint64_t scaled = (uint64_t)value * 65535;
+    if (roundUp) scaled += ANALOG_MAX - 1;
+    return (uint16_t)(scaled >> ANALOG_SHIFT);
+}
@@ -34,15 +34,17 @@ void GamepadUSBHostListener::unmount(uint8_t dev_addr) {
     controller_vid = 0x00;
 }
 
-void GamepadUSBHostListener::report_received(uint8_t dev_addr, uint8_t instance, uint8_t const* report, uint16_t len) {
+bool GamepadUSBHostListener::wantsReports(uint8_t dev_addr, uint8_t instance) {
     // if a hid device hasn't been mounted
-    if ( _controller_host_enabled == false ) return;
+    if ( _controller_host_enabled == false ) return false;
 
-    // Interface protocol (hid_interface_protocol_enum_t)
-    uint8_t const itf_protocol = tuh_hid_interface_protocol(dev_addr, instance);
+    // Interface protocol (hid_interface_protocol_enum_t), keyboards are left to the keyboard listener
+    return tuh_hid_interface_protocol(dev_addr, instance) != HID_ITF_PROTOCOL_KEYBOARD;
+}
 
-    // stop execution if a keyboard or mouse is mounted
-    if ( itf_protocol == HID_ITF_PROTOCOL_KEYBOARD ) return;
+// Only called for interfaces wantsReports() accepted
+void GamepadUSBHostListener::report_received(uint8_t dev_addr, uint8_t instance, uint8_t const* report, uint16_t len) {
+    if ( _controller_host_enabled == false ) return;
 
     process_ctrlr_report(dev_addr, report, len);
 }
@@ -125,6 +125,16 @@ void KeyboardHostListener::unmount(uint8_t dev_addr) {
     }
 }
 
+bool KeyboardHostListener::wantsReports(uint8_t dev_addr, uint8_t instance) {
+  return ( _keyboard_host_mounted == true && _keyboard_dev_addr == dev_addr && _keyboard_instance == instance ) ||
+         ( _mouse_host_mounted == true && _mouse_dev_addr == dev_addr && _mouse_instance == instance );
+}
+
+// Keyboard reports carry every held key, mouse reports only the motion since the last one
+bool KeyboardHostListener::latestReportOnly(uint8_t dev_addr, uint8_t instance) {
+  return _keyboard_host_mounted == true && _keyboard_dev_addr == dev_addr && _keyboard_instance == instance;
+}
+
 void KeyboardHostListener::report_received(uint8_t dev_addr, uint8_t instance, uint8_t const* report, uint16_t len){
   // do nothing if we haven't mounted
 if ( _keyboard_host_mounted == false && _mouse_host_mounted == false )
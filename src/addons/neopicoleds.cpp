@@ -302,11 +302,15 @@ void NeoPicoLEDAddon::ambientLightCustom() {
 	if ( maxFrame > FRAME_MAX - alStartIndex )
 		maxFrame = FRAME_MAX - alStartIndex; // make sure we don't go over 100 and overflow frame[]
 
+	uint32_t alValue;
+	uint16_t alScale;
+
 	// Start-up Animations in Haute were here
 	switch(options.ambientLightEffectsCountIndex) {
 		case AL_CUSTOM_EFFECT_STATIC_COLOR: 
+			alValue = alCustomStaticColors[options.alCustomStaticColorIndex].value(Animation::format, options.alStaticColorBrightnessCustomX);
 			for(int i = 0; i < maxFrame; i++) {
-				frame[alStartIndex + i] = alCustomStaticColors[options.alCustomStaticColorIndex].value(Animation::format, options.alStaticColorBrightnessCustomX);
+				frame[alStartIndex + i] = alValue;
 			}
 			break;
 
@@ -342,8 +346,9 @@ void NeoPicoLEDAddon::ambientLightCustom() {
 				}
 			}
 			// Fill Frame
+			alValue = ambientLight.value(Animation::format, options.alGradientBrightnessCustomX);
 			for(int i = 0; i < maxFrame; i++){
-				frame[alStartIndex + i] = ambientLight.value(Animation::format, options.alGradientBrightnessCustomX);
+				frame[alStartIndex + i] = alValue;
 			}
 			break;
 		case AL_CUSTOM_EFFECT_CHASE: 
@@ -387,14 +392,15 @@ void NeoPicoLEDAddon::ambientLightCustom() {
 			for(int j = 0; j < maxFrame; j++){
 				frame[alStartIndex + j] = 0x0;
 			}
+			alValue = ambientLight.value(Animation::format, options.alChaseBrightnessCustomX);
 			// Fill up to four pixels forward
 			for(int i = 0; i < CHASE_LIGHTS_TURN_ON && chaseLightIndex + i < chaseLightMaxIndexPos; i++) {
-				frame[chaseLightIndex + i] = ambientLight.value(Animation::format, options.alChaseBrightnessCustomX);
+				frame[chaseLightIndex + i] = alValue;
 			}
 			// Fill up to 3 pixels in the beginning of our casergb (wrap-around)
 			if ( chaseLightIndex + CHASE_LIGHTS_TURN_ON > chaseLightMaxIndexPos ) {
 				for(int i = 0; i < (chaseLightIndex + CHASE_LIGHTS_TURN_ON) - chaseLightMaxIndexPos; i++) {
-					frame[alStartIndex + i] = ambientLight.value(Animation::format, options.alChaseBrightnessCustomX);
+					frame[alStartIndex + i] = alValue;
 				}
 			}
 			break;
@@ -435,22 +441,24 @@ void NeoPicoLEDAddon::ambientLightCustom() {
 				breathLedEffectCycle = 0;	
 			}
 			// Fill Frame
+			alValue = ambientLight.value(Animation::format, alBrightnessBreathX);
 			for(int i = 0; i < maxFrame; i++) {
-				frame[alStartIndex + i] = ambientLight.value(Animation::format, alBrightnessBreathX);
+				frame[alStartIndex + i] = alValue;
 			}
 			break;
 		case AL_CUSTOM_EFFECT_STATIC_THEME:
 			multipleOfCustomStaticThemeCount = maxFrame / AL_COL;
 			remainderOfCustomStaticThemeCount = maxFrame % AL_COL;
+			alScale = RGB::scaleOf(options.alStaticBrightnessCustomThemeX);
 			// Fill frame with extras on remainder
 			for(int i = 0; i < multipleOfCustomStaticThemeCount; i++){
 				for(int j = 0; j < AL_COL; j++){
-					frame[alStartIndex + i*AL_COL + j] = alCustomStaticTheme[options.alCustomStaticThemeIndex][j].value(Animation::format, options.alStaticBrightnessCustomThemeX);
+					frame[alStartIndex + i*AL_COL + j] = alCustomStaticTheme[options.alCustomStaticThemeIndex][j].scaledValue(Animation::format, alScale);
 				}
 			}
 			if(remainderOfCustomStaticThemeCount != 0){
 				for(int k = 0; k < remainderOfCustomStaticThemeCount; k++){
-					frame[alStartIndex + multipleOfCustomStaticThemeCount * AL_COL + k] = alCustomStaticTheme[options.alCustomStaticThemeIndex][k].value(Animation::format, options.alStaticBrightnessCustomThemeX);
+					frame[alStartIndex + multipleOfCustomStaticThemeCount * AL_COL + k] = alCustomStaticTheme[options.alCustomStaticThemeIndex][k].scaledValue(Animation::format, alScale);
 				}
 			}
 			break;
@@ -460,23 +468,28 @@ void NeoPicoLEDAddon::ambientLightCustom() {
 }
 
 void NeoPicoLEDAddon::ambientLightLinkage() {
-	float preLinkageBrightnessX = as.GetLinkageModeOfBrightnessX();
+	uint16_t preLinkageScale = RGB::scaleOf(as.GetLinkageModeOfBrightnessX());
 	for(int i = 0; i < multipleOfButtonLedsCount; i++){ // Repeat buttons
 		for(int j = 0; j < buttonLedCount; j++){
-			frame[alLinkageStartIndex + i*buttonLedCount + j] = as.linkageFrame[j].value(Animation::format, preLinkageBrightnessX);
+			frame[alLinkageStartIndex + i*buttonLedCount + j] = as.linkageFrame[j].scaledValue(Animation::format, preLinkageScale);
 		}
 	}
 	
 	if(remainderOfButtonLedsCount != 0){ // Remainder
 		for(int k = 0; k < remainderOfButtonLedsCount; k++){
-			frame[alLinkageStartIndex + multipleOfButtonLedsCount * buttonLedCount + k] = as.linkageFrame[k].value(Animation::format, preLinkageBrightnessX);
+			frame[alLinkageStartIndex + multipleOfButtonLedsCount * buttonLedCount + k] = as.linkageFrame[k].scaledValue(Animation::format, preLinkageScale);
 		}
 	}
 }
 
 void NeoPicoLEDAddon::process() {
     const LEDOptions& ledOptions = Storage::getInstance().getLedOptions();
-    if (!isValidPin(ledOptions.dataPin) || !time_reached(this->nextRunTime))
+    if (!isValidPin(ledOptions.dataPin))
+        return;
+
+    // Finish off a frame that came in while the last one was still going out
+    neopico.Update();
+    if (!time_reached(this->nextRunTime))
         return;
 
     // Get turbo options (turbo RGB led)
@@ -514,17 +527,8 @@ void NeoPicoLEDAddon::process() {
     }
 
     uint32_t buttonState = gamepad->state.dpad << 16 | gamepad->state.buttons;
-    vector<Pixel> pressed;
-    for (auto row : matrix.pixels)
-    {
-        for (auto pixel : row)
-        {
-            if (buttonState & pixel.mask)
-                pressed.push_back(pixel);
-        }
-    }
-    if (pressed.size() > 0)
-        as.HandlePressed(pressed);
+    if (matrix.getPressedPixels(buttonState) != 0)
+        as.HandlePressed(buttonState);
     else
         as.ClearPressed();
 
@@ -543,16 +547,16 @@ void NeoPicoLEDAddon::process() {
     // Apply the player LEDs to our first 4 leds if we're in NEOPIXEL mode
     if (ledOptions.pledType == PLED_TYPE_RGB) {
         int32_t pledIndexes[] = { ledOptions.pledIndex1, ledOptions.pledIndex2, ledOptions.pledIndex3, ledOptions.pledIndex4 };
+        uint32_t scale = RGB::scaleOf(as.GetBrightnessX());
         for (int i = 0; i < PLED_COUNT; i++) {
             if (pledIndexes[i] < 0 || pledIndexes[i] > 99)
                 continue;
 
-            float level = (static_cast<float>(PLED_MAX_LEVEL - neoPLEDs->getLedLevels()[i]) / static_cast<float>(PLED_MAX_LEVEL));
-            float brightness = as.GetBrightnessX() * level;
+            uint16_t brightness = (scale * (PLED_MAX_LEVEL - neoPLEDs->getLedLevels()[i])) / PLED_MAX_LEVEL;
             if (gamepad->auxState.sensors.statusLight.enabled && gamepad->auxState.sensors.statusLight.active) {
-                rgbPLEDValues[i] = (RGB(gamepad->auxState.sensors.statusLight.color.red, gamepad->auxState.sensors.statusLight.color.green, gamepad->auxState.sensors.statusLight.color.blue)).value(neopico.GetFormat(), brightness);
+                rgbPLEDValues[i] = (RGB(gamepad->auxState.sensors.statusLight.color.red, gamepad->auxState.sensors.statusLight.color.green, gamepad->auxState.sensors.statusLight.color.blue)).scaledValue(neopico.GetFormat(), brightness);
             } else {
-                rgbPLEDValues[i] = ((RGB)ledOptions.pledColor).value(neopico.GetFormat(), brightness);
+                rgbPLEDValues[i] = ((RGB)ledOptions.pledColor).scaledValue(neopico.GetFormat(), brightness);
             }
             frame[pledIndexes[i]] = rgbPLEDValues[i];
         }
@@ -1091,7 +1095,7 @@ void NeoPicoLEDAddon::ambientHotkeys(Gamepad *gamepad)
 	}
 
 	if (reqSave) {
-		EventManager::getInstance().triggerEvent(new GPStorageSaveEvent(false));
+		EventManager::getInstance().triggerEvent(GPStorageSaveEvent(false));
 	}
 
 	lastAmbientAction = action;
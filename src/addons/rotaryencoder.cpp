@@ -2,6 +2,7 @@
 
 #include "eventmanager.h"
 #include "storagemanager.h"
+#include "peripheralmanager.h"
 #include "GPEncoderEvent.h"
 #include "types.h"
 
@@ -9,6 +10,9 @@
 #include "helper.h"
 #include "config.pb.h"
 
+#include "hardware/pio.h"
+#include "rotaryencoder.pio.h"
+
 bool RotaryEncoderInput::available() {
     const RotaryOptions& options = Storage::getInstance().getAddonOptions().rotaryOptions;
     return options.enabled;
@@ -52,6 +56,8 @@ void RotaryEncoderInput::setup()
             gpio_init(encoderMap[i].pinB);             // Initialize pin
             gpio_set_dir(encoderMap[i].pinB, GPIO_IN); // Set as INPUT
             gpio_pull_up(encoderMap[i].pinB);          // Set as PULLUP
+
+            setupCounter(i);
         }
     
         if ((encoderMap[i].mode == ENCODER_MODE_LEFT_TRIGGER) || (encoderMap[i].mode == ENCODER_MODE_RIGHT_TRIGGER)) {
@@ -74,13 +80,17 @@ void RotaryEncoderInput::process()
     for (uint8_t i = 0; i < MAX_ENCODERS; i++) {
         if (encoderMap[i].enabled) {
             uint32_t lastUpdate = now - encoderState[i].updateTime;
-
-            if (lastUpdate >= encoderState[i].delay) {
+            uint32_t encoderIncrement = (ENCODER_RADIUS / (encoderMap[i].pulsesPerRevolution / (ENCODER_PRECISION * encoderMap[i].multiplier)));
+
+            if (encoderState[i].stateMachine >= 0) {
+                // every edge since the last call has already been counted
+                int32_t count = rotary_encoder_get_count(pio1, encoderState[i].stateMachine);
+                encoderValues[i] += (count - encoderState[i].count) * (int32_t)encoderIncrement;
+                encoderState[i].count = count;
+            } else if (lastUpdate >= encoderState[i].delay) {
                 bool pinAValue = gpio_get(encoderMap[i].pinA);
                 bool pinBValue = gpio_get(encoderMap[i].pinB);
 
-                uint32_t encoderIncrement = (ENCODER_RADIUS / (encoderMap[i].pulsesPerRevolution / (ENCODER_PRECISION * encoderMap[i].multiplier)));
-
                 if (encoderState[i].pinA != pinAValue || encoderState[i].pinB != pinBValue) {
                     if ((encoderState[i].pinA == encoderState[i].prevA) && (encoderState[i].pinB == encoderState[i].prevB)) {
                         if ((encoderState[i].pinA && !encoderState[i].pinB && pinBValue) || (!encoderState[i].pinA && encoderState[i].pinB && !pinBValue)) {
@@ -132,9 +142,9 @@ void RotaryEncoderInput::process()
                 encoderState[i].changeTime = now;
 
                 if ((encoderValues[i] - prevValues[i]) > 0) {
-                    EventManager::getInstance().triggerEvent(new GPEncoderChangeEvent(i, 1));
+                    EventManager::getInstance().triggerEvent(GPEncoderChangeEvent(i, 1));
                 } else if ((encoderValues[i] - prevValues[i]) < 0) {
-                    EventManager::getInstance().triggerEvent(new GPEncoderChangeEvent(i, -1));
+                    EventManager::getInstance().triggerEvent(GPEncoderChangeEvent(i, -1));
                 }
             }
 
@@ -221,6 +231,29 @@ int32_t RotaryEncoderInput::bounds(int32_t x, int32_t out_min, int32_t out_max)
     return (x < out_min) ? out_min : ((x > out_max) ? out_max : x);
 }
 
+// Count the encoder's edges on a PIO1 state machine so none are missed between process() calls,
+// if there's one to spare. PIO1 belongs to the PIO USB host when that's enabled.
+void RotaryEncoderInput::setupCounter(uint8_t index) {
+    if (PeripheralManager::getInstance().isUSBEnabled(0))
+        return;
+
+    int stateMachine = pio_claim_unused_sm(pio1, false);
+    if (stateMachine < 0)
+        return;
+
+    if (counterOffset < 0) {
+        if (!pio_can_add_program(pio1, &rotary_encoder_program)) {
+            pio_sm_unclaim(pio1, stateMachine);
+            return;
+        }
+        counterOffset = pio_add_program(pio1, &rotary_encoder_program);
+    }
+
+    rotary_encoder_program_init(pio1, stateMachine, counterOffset, encoderMap[index].pinA, encoderMap[index].pinB);
+    encoderState[index].stateMachine = stateMachine;
+    encoderState[index].count = rotary_encoder_get_count(pio1, stateMachine);
+}
+
 int8_t RotaryEncoderInput::getEncoderIndexByPin(uint8_t pin) {
     for (uint8_t i = 0; i < MAX_ENCODERS; i++) {
         if (encoderMap[i].enabled && ((encoderMap[i].pinA != -1) && (encoderMap[i].pinB != -1))) {
@@ -1,6 +1,7 @@
 #include "addons/snes_input.h"
 #include "drivermanager.h"
 #include "storagemanager.h"
+#include "peripheralmanager.h"
 #include "hardware/gpio.h"
 #include "helper.h"
 
@@ -27,7 +28,14 @@ void SNESpadInput::setup() {
         snesOptions.clockPin,
         snesOptions.latchPin,
         snesOptions.dataPin);
-    snes->begin();
+
+    // PIO1 is free unless the PIO USB host is using it for receive, NeoPico has PIO0 SM0 without
+    // claiming it. Without a state machine the pad gets bit-banged from process() instead.
+    if (PeripheralManager::getInstance().isUSBEnabled(0)) {
+        snes->begin();
+    } else {
+        snes->begin(pio1);
+    }
     snes->start();
 
     // Run during setup to catch boot selection mode
@@ -19,18 +19,20 @@ void SPIAnalog1256Input::setup() {
     // Init our ADS1256 library
     ads = new ADS1256(spi, options.drdyPin, -1, -1, options.csPin, (float)ADS1256_VREF_VOLTAGE);
     ads->init(ADS1256_DRATE_30000SPS, ADS1256_PGA_1, true);
+
+    // Sticks on AIN0-3 and triggers on AIN4-5, converted one after the other in the background
+    const uint8_t inputs[] = { ADS1256_SING_0, ADS1256_SING_1, ADS1256_SING_2, ADS1256_SING_3, ADS1256_SING_4, ADS1256_SING_5 };
+    ads->startCycling(inputs, readChannelCount);
 }
 
 void SPIAnalog1256Input::process() {
-    // Read the first X channels
+    // Leave the sticks centered until every channel has been converted once
+    if (ads->getCyclePasses() == 0) return;
+
     for (uint8_t i = 0; i < readChannelCount; i++) {
-        values[i] = ads->convertToVoltage(ads->cycleSingle());
+        values[i] = ads->convertToVoltage(ads->getCycledValue(i));
     }
 
-    // Tells the ADC we're done sampling and flags to reset
-    // the read cycle next time an ADC read is performed
-    ads->stopConversion();
-
     Gamepad * gamepad = Storage::getInstance().GetGamepad();
 
     gamepad->state.lx = convert24to16bit(values[0]);
@@ -1,6 +1,6 @@
 #include "addons/turbo.h"
 
-#include "hardware/adc.h"
+#include "adcsampler.h"
 
 #include "storagemanager.h"
 #include "helper.h"
@@ -45,10 +45,9 @@ void TurboInput::setup(){
     uint8_t shotCount = std::clamp<uint8_t>(options.shotCount, TURBO_SHOT_MIN, TURBO_SHOT_MAX);
     if (isValidPin(options.shmupDialPin)) {
         hasShmupDial = true;
-        adc_gpio_init(options.shmupDialPin);
-        adcShmupDial = 26 - options.shmupDialPin;
-        adc_select_input(adcShmupDial);
-        dialValue = adc_read(); // setup initial Dial + Turbo Speed
+        shmupDialPin = options.shmupDialPin;
+        ADCSampler::getInstance().addPin(shmupDialPin);
+        dialValue = ADCSampler::getInstance().read(shmupDialPin); // setup initial Dial + Turbo Speed
         shotCount = (dialValue / TURBO_DIAL_INCREMENTS) + TURBO_SHOT_MIN;
     } else {
         dialValue = 0;
@@ -179,8 +178,7 @@ void TurboInput::process()
 
     // Use the dial to modify our turbo shot speed (don't save on dial modify)
     if (hasShmupDial && nextAdcRead < now) {
-        adc_select_input(adcShmupDial);
-        dialValue = adc_read();
+        dialValue = ADCSampler::getInstance().read(shmupDialPin);
         uint8_t shotCount = (dialValue / TURBO_DIAL_INCREMENTS) + TURBO_SHOT_MIN;
         if (shotCount != options.shotCount) {
             updateInterval(shotCount);
@@ -244,7 +242,7 @@ void TurboInput::updateTurboShotCount(uint8_t shotCount) {
     shotCount = std::clamp<uint8_t>(shotCount, TURBO_SHOT_MIN, TURBO_SHOT_MAX);
     if (shotCount != options.shotCount) {
         options.shotCount = shotCount;
-    EventManager::getInstance().triggerEvent(new GPStorageSaveEvent(false));
+    EventManager::getInstance().triggerEvent(GPStorageSaveEvent(false));
     }
     updateInterval(shotCount);
 }
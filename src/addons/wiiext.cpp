@@ -24,14 +24,11 @@ bool WiiExtensionInput::available() {
 
 void WiiExtensionInput::setup() {
     const WiiOptions& options = Storage::getInstance().getAddonOptions().wiiOptions;
-    nextTimer = getMillis();
 
 #if WII_EXTENSION_DEBUG==true
     stdio_init_all();
 #endif
 
-    uIntervalMS = 0;
-
     currentConfig = NULL;
     
     //wii = new WiiExtensionDevice(
@@ -49,51 +46,27 @@ void WiiExtensionInput::setup() {
 }
 
 void WiiExtensionInput::process() {
-    if (nextTimer < getMillis()) {
-        wii->poll();
-
+    // The extension is polled in the background and every new report rebuilds the snapshot in
+    // update(), so all that's left here is merging it into the gamepad. A failed read drops the
+    // extension without a new report, so catch that here too or its last state stays merged in.
+    if (wii->service() || ((currentConfig != NULL) && (wii->extensionType == WII_EXTENSION_NONE))) {
         update();
-              
-        nextTimer = getMillis() + uIntervalMS;
     }
 
     if (currentConfig != NULL) {
-        queueAnalogChange(WiiAnalogs::WII_ANALOG_LEFT_X, leftX, lastLeftX);
-        queueAnalogChange(WiiAnalogs::WII_ANALOG_LEFT_Y, leftY, lastLeftY);
-        queueAnalogChange(WiiAnalogs::WII_ANALOG_RIGHT_X, rightX, lastRightX);
-        queueAnalogChange(WiiAnalogs::WII_ANALOG_RIGHT_Y, rightY, lastRightY);
-        queueAnalogChange(WiiAnalogs::WII_ANALOG_LEFT_TRIGGER, triggerLeft, lastTriggerLeft);
-        queueAnalogChange(WiiAnalogs::WII_ANALOG_RIGHT_TRIGGER, triggerRight, lastTriggerRight);
-        updateAnalogState();
-
-        setButtonState(buttonC, WiiButtons::WII_BUTTON_C);
-        setButtonState(buttonZ, WiiButtons::WII_BUTTON_Z);
-
-        setButtonState(buttonA, WiiButtons::WII_BUTTON_A);
-        setButtonState(buttonB, WiiButtons::WII_BUTTON_B);
-        setButtonState(buttonX, WiiButtons::WII_BUTTON_X);
-        setButtonState(buttonY, WiiButtons::WII_BUTTON_Y);
-        setButtonState(buttonL, WiiButtons::WII_BUTTON_L);
-        setButtonState(buttonZL, WiiButtons::WII_BUTTON_ZL);
-        setButtonState(buttonR, WiiButtons::WII_BUTTON_R);
-        setButtonState(buttonZR, WiiButtons::WII_BUTTON_ZR);
-        setButtonState(buttonSelect, WiiButtons::WII_BUTTON_MINUS);
-        setButtonState(buttonStart, WiiButtons::WII_BUTTON_PLUS);
-        setButtonState(buttonHome, WiiButtons::WII_BUTTON_HOME);
-
-        setButtonState(dpadUp, WiiButtons::WII_BUTTON_UP);
-        setButtonState(dpadDown, WiiButtons::WII_BUTTON_DOWN);
-        setButtonState(dpadLeft, WiiButtons::WII_BUTTON_LEFT);
-        setButtonState(dpadRight, WiiButtons::WII_BUTTON_RIGHT);
+        Gamepad * gamepad = Storage::getInstance().GetGamepad();
+        gamepad->hasAnalogTriggers = isAnalogTriggers;
+        gamepad->state.dpad |= mergeState.dpad;
+        gamepad->state.buttons |= mergeState.buttons;
+
+        if (mergeAxes & (1 << WII_ANALOG_TYPE_LEFT_STICK_X)) gamepad->state.lx = mergeState.lx;
+        if (mergeAxes & (1 << WII_ANALOG_TYPE_LEFT_STICK_Y)) gamepad->state.ly = mergeState.ly;
+        if (mergeAxes & (1 << WII_ANALOG_TYPE_RIGHT_STICK_X)) gamepad->state.rx = mergeState.rx;
+        if (mergeAxes & (1 << WII_ANALOG_TYPE_RIGHT_STICK_Y)) gamepad->state.ry = mergeState.ry;
+        if (mergeAxes & (1 << WII_ANALOG_TYPE_LEFT_TRIGGER)) gamepad->state.lt = mergeState.lt;
+        if (mergeAxes & (1 << WII_ANALOG_TYPE_RIGHT_TRIGGER)) gamepad->state.rt = mergeState.rt;
 
         updateMotionState();
-
-        if (lastLeftX != leftX) lastLeftX = leftX;
-        if (lastLeftY != leftY) lastLeftY = leftY;
-        if (lastRightX != rightX) lastRightX = rightX;
-        if (lastRightY != rightY) lastRightY = rightY;
-        if (lastTriggerLeft != triggerLeft) lastTriggerLeft = triggerLeft;
-        if (lastTriggerRight != triggerRight) lastTriggerRight = triggerRight;
     }
 }
 
@@ -274,11 +247,57 @@ void WiiExtensionInput::update() {
             accelerometerZ = wii->getController()->motionState[WiiMotions::WII_ACCELEROMETER_Z];
             isAccelerometer = true;
         }
+
+        updateMergeState();
     } else {
         currentConfig = NULL;
+        mergeState.dpad = 0;
+        mergeState.buttons = 0;
+        mergeAxes = 0;
     }
 }
 
+void WiiExtensionInput::updateMergeState() {
+    mergeState.dpad = 0;
+    mergeState.buttons = 0;
+    mergeAxes = 0;
+
+    queueAnalogChange(WiiAnalogs::WII_ANALOG_LEFT_X, leftX, lastLeftX);
+    queueAnalogChange(WiiAnalogs::WII_ANALOG_LEFT_Y, leftY, lastLeftY);
+    queueAnalogChange(WiiAnalogs::WII_ANALOG_RIGHT_X, rightX, lastRightX);
+    queueAnalogChange(WiiAnalogs::WII_ANALOG_RIGHT_Y, rightY, lastRightY);
+    queueAnalogChange(WiiAnalogs::WII_ANALOG_LEFT_TRIGGER, triggerLeft, lastTriggerLeft);
+    queueAnalogChange(WiiAnalogs::WII_ANALOG_RIGHT_TRIGGER, triggerRight, lastTriggerRight);
+    updateAnalogState();
+
+    setButtonState(buttonC, WiiButtons::WII_BUTTON_C);
+    setButtonState(buttonZ, WiiButtons::WII_BUTTON_Z);
+
+    setButtonState(buttonA, WiiButtons::WII_BUTTON_A);
+    setButtonState(buttonB, WiiButtons::WII_BUTTON_B);
+    setButtonState(buttonX, WiiButtons::WII_BUTTON_X);
+    setButtonState(buttonY, WiiButtons::WII_BUTTON_Y);
+    setButtonState(buttonL, WiiButtons::WII_BUTTON_L);
+    setButtonState(buttonZL, WiiButtons::WII_BUTTON_ZL);
+    setButtonState(buttonR, WiiButtons::WII_BUTTON_R);
+    setButtonState(buttonZR, WiiButtons::WII_BUTTON_ZR);
+    setButtonState(buttonSelect, WiiButtons::WII_BUTTON_MINUS);
+    setButtonState(buttonStart, WiiButtons::WII_BUTTON_PLUS);
+    setButtonState(buttonHome, WiiButtons::WII_BUTTON_HOME);
+
+    setButtonState(dpadUp, WiiButtons::WII_BUTTON_UP);
+    setButtonState(dpadDown, WiiButtons::WII_BUTTON_DOWN);
+    setButtonState(dpadLeft, WiiButtons::WII_BUTTON_LEFT);
+    setButtonState(dpadRight, WiiButtons::WII_BUTTON_RIGHT);
+
+    if (lastLeftX != leftX) lastLeftX = leftX;
+    if (lastLeftY != leftY) lastLeftY = leftY;
+    if (lastRightX != rightX) lastRightX = rightX;
+    if (lastRightY != rightY) lastRightY = rightY;
+    if (lastTriggerLeft != triggerLeft) lastTriggerLeft = triggerLeft;
+    if (lastTriggerRight != triggerRight) lastTriggerRight = triggerRight;
+}
+
 void WiiExtensionInput::setControllerButton(uint16_t controllerID, uint16_t buttonID, uint32_t buttonMask) {
     extensionConfigs[controllerID].buttonMap[buttonID] = buttonMask;
 }
@@ -372,16 +391,14 @@ void WiiExtensionInput::reloadConfig() {
 }
 
 void WiiExtensionInput::setButtonState(bool buttonState, uint16_t buttonMask) {
-    Gamepad * gamepad = Storage::getInstance().GetGamepad();
-
     if (buttonState) {
         if (currentConfig->buttonMap[buttonMask] > GAMEPAD_MASK_A2) {
-            if (((currentConfig->buttonMap[buttonMask] >> 16) & GAMEPAD_MASK_UP) == GAMEPAD_MASK_UP) gamepad->state.dpad    |= ((currentConfig->buttonMap[buttonMask] >> 16) & GAMEPAD_MASK_UP);
-            if (((currentConfig->buttonMap[buttonMask] >> 16) & GAMEPAD_MASK_DOWN) == GAMEPAD_MASK_DOWN) gamepad->state.dpad    |= ((currentConfig->buttonMap[buttonMask] >> 16) & GAMEPAD_MASK_DOWN);
-            if (((currentConfig->buttonMap[buttonMask] >> 16) & GAMEPAD_MASK_LEFT) == GAMEPAD_MASK_LEFT) gamepad->state.dpad    |= ((currentConfig->buttonMap[buttonMask] >> 16) & GAMEPAD_MASK_LEFT);
-            if (((currentConfig->buttonMap[buttonMask] >> 16) & GAMEPAD_MASK_RIGHT) == GAMEPAD_MASK_RIGHT) gamepad->state.dpad    |= ((currentConfig->buttonMap[buttonMask] >> 16) & GAMEPAD_MASK_RIGHT);
+            if (((currentConfig->buttonMap[buttonMask] >> 16) & GAMEPAD_MASK_UP) == GAMEPAD_MASK_UP) mergeState.dpad    |= ((currentConfig->buttonMap[buttonMask] >> 16) & GAMEPAD_MASK_UP);
+            if (((currentConfig->buttonMap[buttonMask] >> 16) & GAMEPAD_MASK_DOWN) == GAMEPAD_MASK_DOWN) mergeState.dpad    |= ((currentConfig->buttonMap[buttonMask] >> 16) & GAMEPAD_MASK_DOWN);
+            if (((currentConfig->buttonMap[buttonMask] >> 16) & GAMEPAD_MASK_LEFT) == GAMEPAD_MASK_LEFT) mergeState.dpad    |= ((currentConfig->buttonMap[buttonMask] >> 16) & GAMEPAD_MASK_LEFT);
+            if (((currentConfig->buttonMap[buttonMask] >> 16) & GAMEPAD_MASK_RIGHT) == GAMEPAD_MASK_RIGHT) mergeState.dpad    |= ((currentConfig->buttonMap[buttonMask] >> 16) & GAMEPAD_MASK_RIGHT);
         } else {
-            gamepad->state.buttons |= currentConfig->buttonMap[buttonMask];
+            mergeState.buttons |= currentConfig->buttonMap[buttonMask];
         }
     }
 }
@@ -391,9 +408,6 @@ void WiiExtensionInput::queueAnalogChange(uint16_t analogInput, uint16_t analogV
 }
 
 void WiiExtensionInput::updateAnalogState() {
-    Gamepad * gamepad = Storage::getInstance().GetGamepad();
-    gamepad->hasAnalogTriggers = isAnalogTriggers;
-
     uint16_t joystickMid = GAMEPAD_JOYSTICK_MID;
     if ( DriverManager::getInstance().getDriver() != nullptr ) {
         joystickMid = DriverManager::getInstance().getDriver()->GetJoystickMidValue();
@@ -468,12 +482,12 @@ void WiiExtensionInput::updateAnalogState() {
                     adjustedValue = bounds(analogValue,minValue,maxValue);
                     break;
                 case WII_ANALOG_TYPE_DPAD_X:
-                    if (analogValue < midValue/2) gamepad->state.dpad |= GAMEPAD_MASK_LEFT;
-                    if (analogValue > midValue+(midValue/2)) gamepad->state.dpad |= GAMEPAD_MASK_RIGHT;
+                    if (analogValue < midValue/2) mergeState.dpad |= GAMEPAD_MASK_LEFT;
+                    if (analogValue > midValue+(midValue/2)) mergeState.dpad |= GAMEPAD_MASK_RIGHT;
                     break;
                 case WII_ANALOG_TYPE_DPAD_Y:
-                    if (analogValue < midValue/2) gamepad->state.dpad |= GAMEPAD_MASK_UP;
-                    if (analogValue > midValue+(midValue/2)) gamepad->state.dpad |= GAMEPAD_MASK_DOWN;
+                    if (analogValue < midValue/2) mergeState.dpad |= GAMEPAD_MASK_UP;
+                    if (analogValue > midValue+(midValue/2)) mergeState.dpad |= GAMEPAD_MASK_DOWN;
                     break;
                 case WII_ANALOG_TYPE_LEFT_TRIGGER:
                     axisToChange = WII_ANALOG_TYPE_LEFT_TRIGGER;
@@ -544,22 +558,28 @@ void WiiExtensionInput::updateAnalogState() {
 
             switch (axisType) {
                 case WII_ANALOG_TYPE_LEFT_STICK_X:
-                    gamepad->state.lx = getDelta(currAxis->second, joystickMid);
+                    mergeAxes |= (1 << WII_ANALOG_TYPE_LEFT_STICK_X);
+                    mergeState.lx = getDelta(currAxis->second, joystickMid);
                     break;
                 case WII_ANALOG_TYPE_LEFT_STICK_Y:
-                    gamepad->state.ly = getDelta(currAxis->second, joystickMid);
+                    mergeAxes |= (1 << WII_ANALOG_TYPE_LEFT_STICK_Y);
+                    mergeState.ly = getDelta(currAxis->second, joystickMid);
                     break;
                 case WII_ANALOG_TYPE_RIGHT_STICK_X:
-                    gamepad->state.rx = getDelta(currAxis->second, joystickMid);
+                    mergeAxes |= (1 << WII_ANALOG_TYPE_RIGHT_STICK_X);
+                    mergeState.rx = getDelta(currAxis->second, joystickMid);
                     break;
                 case WII_ANALOG_TYPE_RIGHT_STICK_Y:
-                    gamepad->state.ry = getDelta(currAxis->second, joystickMid);
+                    mergeAxes |= (1 << WII_ANALOG_TYPE_RIGHT_STICK_Y);
+                    mergeState.ry = getDelta(currAxis->second, joystickMid);
                     break;
                 case WII_ANALOG_TYPE_LEFT_TRIGGER:
-                    gamepad->state.lt = getDelta(currAxis->second, GAMEPAD_TRIGGER_MID);
+                    mergeAxes |= (1 << WII_ANALOG_TYPE_LEFT_TRIGGER);
+                    mergeState.lt = getDelta(currAxis->second, GAMEPAD_TRIGGER_MID);
                     break;
                 case WII_ANALOG_TYPE_RIGHT_TRIGGER:
-                    gamepad->state.rt = getDelta(currAxis->second, GAMEPAD_TRIGGER_MID);
+                    mergeAxes |= (1 << WII_ANALOG_TYPE_RIGHT_TRIGGER);
+                    mergeState.rt = getDelta(currAxis->second, GAMEPAD_TRIGGER_MID);
                     break;
             }
         }
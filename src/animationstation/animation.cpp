@@ -7,22 +7,18 @@
 #define PRESS_COOLDOWN_MIN 0
 
 LEDFormat Animation::format;
-std::map<uint32_t, int32_t> Animation::times = {};
-std::map<uint32_t, RGB> Animation::hitColor = {};
+int32_t Animation::times[PIXEL_MATRIX_MAX_PIXELS] = {};
+RGB Animation::hitColor[PIXEL_MATRIX_MAX_PIXELS] = {};
 
 Animation::Animation(PixelMatrix &matrix) : matrix(&matrix) {
-  for (size_t r = 0; r != matrix.pixels.size(); r++) {
-    for (size_t c = 0; c != matrix.pixels[r].size(); c++) {
-      if (matrix.pixels[r][c].index == NO_PIXEL.index)
-        continue;
-      times.insert_or_assign(matrix.pixels[r][c].index, 0);
-      hitColor.insert_or_assign(matrix.pixels[r][c].index, defaultColor);
-    }
+  for (uint8_t i = 0; i < matrix.pixelCount; i++) {
+    times[i] = 0;
+    hitColor[i] = defaultColor;
   }
 }
 
-void Animation::UpdatePixels(std::vector<Pixel> inpixels) {
-  this->pixels = inpixels;
+void Animation::UpdatePixels(uint32_t inPressedPixels) {
+  this->pressedPixels = inPressedPixels;
 }
 
 void Animation::UpdateTime() {
@@ -36,57 +32,59 @@ void Animation::UpdateTime() {
 
 void Animation::UpdatePresses(RGB (&frame)[100]) {
   // Queue up blend on hit
-  for (size_t p = 0; p < pixels.size(); p++) {
-    if (pixels[p].index != NO_PIXEL.index) {
-      times[pixels[p].index] = coolDownTimeInMs;
-      hitColor[pixels[p].index] = frame[pixels[p].positions[0]];
-    }
+  uint32_t pressed = pressedPixels;
+  while (pressed) {
+    uint8_t pixel = __builtin_ctz(pressed);
+    pressed &= pressed - 1;
+
+    times[pixel] = coolDownTimeInMs;
+    if (matrix->offsets[pixel] != matrix->offsets[pixel + 1])
+      hitColor[pixel] = frame[matrix->positions[matrix->offsets[pixel]]];
+    settledPixels &= ~(1u << pixel);
   }
 }
 
-void Animation::DecrementFadeCounter(int32_t index) {
-  times[index] -= updateTimeInMs;
-  if (times[index] < 0) {
-    times[index] = 0;
+void Animation::DecrementFadeCounter(uint8_t pixel) {
+  if (times[pixel] == 0)
+    return;
+
+  times[pixel] -= updateTimeInMs;
+  if (times[pixel] < 0) {
+    times[pixel] = 0;
   };
 }
 
+void Animation::SetPixel(RGB (&frame)[100], uint8_t pixel, RGB color) {
+  for (uint8_t p = matrix->offsets[pixel]; p != matrix->offsets[pixel + 1]; p++)
+    frame[matrix->positions[p]] = color;
+}
+
 void Animation::ClearPixels() {
-  this->pixels.clear();
+  this->pressedPixels = 0;
 }
 
 /* Some of these animations are filtered to specific pixels, such as button press animations.
 This somewhat backwards named method determines if a specific pixel is _not_ included in the filter */
-bool Animation::notInFilter(Pixel pixel) {
+bool Animation::notInFilter(uint8_t pixel) {
   if (!this->filtered) {
     return false;
   }
 
-  for (size_t i = 0; i < this->pixels.size(); i++) {
-    if (pixel == this->pixels.at(i)) {
-      return false;
-    }
-  }
-
-  return true;
+  return (this->pressedPixels & (1u << pixel)) == 0;
 }
 
 RGB Animation::BlendColor(RGB start, RGB end, uint32_t timeRemainingInMs) {
-  RGB result = ColorBlack;
-
-  if (timeRemainingInMs <= 0) {
+  if (timeRemainingInMs <= 0 || coolDownTimeInMs == 0) {
     return end;
   }
 
-  float progress = 1.0f - (static_cast<float>(timeRemainingInMs) / static_cast<float>(coolDownTimeInMs));
-  if (progress < 0.0f) progress = 0.0f;
-  if (progress > 1.0f) progress = 1.0f;
-
-  result.r = static_cast<uint32_t>(static_cast<float>(start.r + (end.r - start.r) * progress));
-  result.g = static_cast<uint32_t>(static_cast<float>(start.g + (end.g - start.g) * progress));
-  result.b = static_cast<uint32_t>(static_cast<float>(start.b + (end.b - start.b) * progress));
+  if (timeRemainingInMs >= coolDownTimeInMs) {
+    return start;
+  }
 
-  return result;
+  // Q8 progress, integer only since the M0+ has no FPU
+  uint16_t progress = 256 - ((timeRemainingInMs << 8) / coolDownTimeInMs);
+  return RGB::blend(start, end, progress);
 }
 
 
@@ -90,7 +90,7 @@ void AnimationStation::HandleEvent(GamepadHotkey action) {
   }
 
 	if (reqSave) {
-		EventManager::getInstance().triggerEvent(new GPStorageSaveEvent(false));
+		EventManager::getInstance().triggerEvent(GPStorageSaveEvent(false));
 	}
 }
 
@@ -114,10 +114,10 @@ uint16_t AnimationStation::AdjustIndex(int changeSize) {
   return (uint16_t)newIndex;
 }
 
-void AnimationStation::HandlePressed(std::vector<Pixel> pressed) {
-  this->lastPressed = pressed;
-  this->baseAnimation->UpdatePixels(pressed);  
-  this->buttonAnimation->UpdatePixels(pressed);
+void AnimationStation::HandlePressed(uint32_t buttonState) {
+  this->pressedPixels = matrix.getPressedPixels(buttonState);
+  this->baseAnimation->UpdatePixels(pressedPixels);
+  this->buttonAnimation->UpdatePixels(pressedPixels);
 }
 
 void AnimationStation::ClearPressed() {
@@ -128,7 +128,7 @@ void AnimationStation::ClearPressed() {
     this->baseAnimation->ClearPixels();
   }
 
-  this->lastPressed.clear();
+  this->pressedPixels = 0;
 }
 
 void AnimationStation::Animate() {
@@ -183,34 +183,45 @@ void AnimationStation::SetMode(uint8_t mode) {
   switch (newEffect) {
   case AnimationEffects::EFFECT_RAINBOW:
     this->baseAnimation = new Rainbow(matrix);
-    this->buttonAnimation = new StaticColor(matrix, lastPressed);
+    this->buttonAnimation = new StaticColor(matrix, pressedPixels);
     break;
   case AnimationEffects::EFFECT_CHASE:
     this->baseAnimation = new Chase(matrix);
-    this->buttonAnimation = new StaticColor(matrix, lastPressed);
+    this->buttonAnimation = new StaticColor(matrix, pressedPixels);
     break;
   case AnimationEffects::EFFECT_STATIC_THEME:
     this->baseAnimation = new StaticTheme(matrix);
-    this->buttonAnimation = new StaticColor(matrix, lastPressed);
+    this->buttonAnimation = new StaticColor(matrix, pressedPixels);
     break;
   case AnimationEffects::EFFECT_CUSTOM_THEME:
     this->baseAnimation = new CustomTheme(matrix);
-    this->buttonAnimation = new CustomThemePressed(matrix, lastPressed);
+    this->buttonAnimation = new CustomThemePressed(matrix, pressedPixels);
     break;
   default:
     this->baseAnimation = new StaticColor(matrix);
-    this->buttonAnimation = new StaticColor(matrix, lastPressed);
+    this->buttonAnimation = new StaticColor(matrix, pressedPixels);
     break;
   }
 }
 
-void AnimationStation::SetMatrix(PixelMatrix matrix) {
+void AnimationStation::SetMatrix(const PixelMatrix & matrix) {
   this->matrix = matrix;
 }
 
 void AnimationStation::ApplyBrightness(uint32_t *frameValue) {
-  for (int i = 0; i < 100; i++)
-    frameValue[i] = this->frame[i].value(Animation::format, brightnessX);
+  // Most of the frame holds still between calls, so keep the converted values around and only
+  // redo the LEDs that changed. The caller overwrites some entries, so always hand back all of them.
+  uint16_t scale = RGB::scaleOf(brightnessX);
+  bool refresh = (scale != appliedScale) || (Animation::format != appliedFormat);
+  for (int i = 0; i < 100; i++) {
+    if (refresh || this->frame[i] != appliedFrame[i]) {
+      appliedFrame[i] = this->frame[i];
+      appliedValues[i] = this->frame[i].scaledValue(Animation::format, scale);
+    }
+  }
+  appliedScale = scale;
+  appliedFormat = Animation::format;
+  memcpy(frameValue, appliedValues, sizeof(appliedValues));
 }
 
 void AnimationStation::SetBrightness(uint8_t brightness) {
@@ -16,22 +16,16 @@ bool Chase::Animate(RGB (&frame)[100]) {
   UpdateTime();
   UpdatePresses(frame);
 
-  for (auto &col : matrix->pixels) {
-    for (auto &pixel : col) {
-      if (pixel.index == NO_PIXEL.index)
-        continue;
-
-      // Count down the timer
-      DecrementFadeCounter(pixel.index);
-
-      if (this->IsChasePixel(pixel.index)) {
-        RGB color = RGB::wheel(this->WheelFrame(pixel.index));
-        for (auto &pos : pixel.positions)
-          frame[pos] = BlendColor(hitColor[pixel.index], color, times[pixel.index]);
-      } else {
-        for (auto &pos : pixel.positions)
-          frame[pos] = BlendColor(hitColor[pixel.index], ColorBlack, times[pixel.index]);
-      }
+  for (uint8_t i = 0; i < matrix->pixelCount; i++) {
+    // Count down the timer
+    DecrementFadeCounter(i);
+
+    int index = matrix->indexes[i];
+    if (this->IsChasePixel(index)) {
+      RGB color = RGB::wheel(this->WheelFrame(index));
+      SetPixel(frame, i, BlendColor(hitColor[i], color, times[i]));
+    } else {
+      SetPixel(frame, i, BlendColor(hitColor[i], ColorBlack, times[i]));
     }
   }
 
@@ -27,10 +27,16 @@ CustomThemePressed::CustomThemePressed(PixelMatrix &matrix) : Animation(matrix)
       theme[GAMEPAD_MASK_L3] = RGB(animationOptions.customThemeL3Pressed);
       theme[GAMEPAD_MASK_R3] = RGB(animationOptions.customThemeR3Pressed);
 	}
+
+  for (uint8_t i = 0; i < matrix.pixelCount; i++) {
+    auto itr = theme.find(matrix.masks[i]);
+    pixelColors[i] = (itr != theme.end()) ? itr->second : defaultColor;
+  }
 }
 
-CustomThemePressed::CustomThemePressed(PixelMatrix &matrix, std::vector<Pixel> &pixels) : Animation(matrix), pixels(&pixels) {
+CustomThemePressed::CustomThemePressed(PixelMatrix &matrix, uint32_t inPressedPixels) : Animation(matrix) {
   this->filtered = true;
+  pressedPixels = inPressedPixels;
 
   AnimationOptions & animationOptions = Storage::getInstance().getAnimationOptions();
   if (animationOptions.hasCustomTheme)
@@ -54,22 +60,19 @@ CustomThemePressed::CustomThemePressed(PixelMatrix &matrix, std::vector<Pixel> &
       theme[GAMEPAD_MASK_L3] = RGB(animationOptions.customThemeL3Pressed);
       theme[GAMEPAD_MASK_R3] = RGB(animationOptions.customThemeR3Pressed);
 	}
+
+  for (uint8_t i = 0; i < matrix.pixelCount; i++) {
+    auto itr = theme.find(matrix.masks[i]);
+    pixelColors[i] = (itr != theme.end()) ? itr->second : defaultColor;
+  }
 }
 
 bool CustomThemePressed::Animate(RGB (&frame)[100]) {
-  for (size_t r = 0; r != matrix->pixels.size(); r++) {
-    for (size_t c = 0; c != matrix->pixels[r].size(); c++) {
-      if (matrix->pixels[r][c].index == NO_PIXEL.index || this->notInFilter(matrix->pixels[r][c]))
-        continue;
-
-      auto itr = theme.find(matrix->pixels[r][c].mask);
-      if (itr != theme.end())
-        for (size_t p = 0; p != matrix->pixels[r][c].positions.size(); p++)
-          frame[matrix->pixels[r][c].positions[p]] = itr->second;
-      else
-        for (size_t p = 0; p != matrix->pixels[r][c].positions.size(); p++)
-          frame[matrix->pixels[r][c].positions[p]] = defaultColor;
-    }
+  uint32_t pressed = pressedPixels;
+  while (pressed) {
+    uint8_t pixel = __builtin_ctz(pressed);
+    pressed &= pressed - 1;
+    SetPixel(frame, pixel, pixelColors[pixel]);
   }
   return true;
 }
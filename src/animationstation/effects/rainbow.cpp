@@ -12,18 +12,12 @@ bool Rainbow::Animate(RGB (&frame)[100]) {
   UpdateTime();
   UpdatePresses(frame);
 
-  for (auto &col : matrix->pixels) {
-    for (auto &pixel : col) {
-      if (pixel.index == NO_PIXEL.index)
-        continue;
+  RGB color = RGB::wheel(this->currentFrame);
+  for (uint8_t i = 0; i < matrix->pixelCount; i++) {
+    // Count down the timer
+    DecrementFadeCounter(i);
 
-      // Count down the timer
-      DecrementFadeCounter(pixel.index);
-
-      RGB color = RGB::wheel(this->currentFrame);
-      for (auto &pos : pixel.positions)
-        frame[pos] = BlendColor(hitColor[pixel.index], color, times[pixel.index]);
-    }
+    SetPixel(frame, i, BlendColor(hitColor[i], color, times[i]));
   }
 
   if (reverse) {
@@ -4,32 +4,39 @@
 StaticColor::StaticColor(PixelMatrix &matrix) : Animation(matrix) {
 }
 
-StaticColor::StaticColor(PixelMatrix &matrix, std::vector<Pixel> &inpixels) : Animation(matrix) {
+StaticColor::StaticColor(PixelMatrix &matrix, uint32_t inPressedPixels) : Animation(matrix) {
   this->filtered = true;
-  pixels = inpixels;
+  pressedPixels = inPressedPixels;
 }
 
 bool StaticColor::Animate(RGB (&frame)[100]) {
   UpdateTime();
   UpdatePresses(frame);
 
-  for (size_t r = 0; r != matrix->pixels.size(); r++) {
-    for (size_t c = 0; c != matrix->pixels[r].size(); c++) {
-      if (matrix->pixels[r][c].index == NO_PIXEL.index || this->notInFilter(matrix->pixels[r][c]))
-        continue;
-
-      // Count down the timer
-      DecrementFadeCounter(matrix->pixels[r][c].index);
-
-      for (size_t p = 0; p != matrix->pixels[r][c].positions.size(); p++) {
-        // Interpolate from hitColor (color the button was assigned when pressed) back to the theme color
-        if (!this->filtered) {
-          frame[matrix->pixels[r][c].positions[p]] = BlendColor(hitColor[matrix->pixels[r][c].index], colors[this->GetColor()], times[matrix->pixels[r][c].index]);
-        } else {
-          frame[matrix->pixels[r][c].positions[p]] = colors[this->GetColor()];
-        }
-      }
+  const RGB color = colors[this->GetColor()];
+  if (color != lastColor) {
+    lastColor = color;
+    settledPixels = 0;
+  }
+
+  for (uint8_t i = 0; i < matrix->pixelCount; i++) {
+    if (this->notInFilter(i))
+      continue;
+
+    if (!this->filtered && isSettled(i))
+      continue;
+
+    // Count down the timer
+    DecrementFadeCounter(i);
+
+    if (this->filtered) {
+      SetPixel(frame, i, color);
+      continue;
     }
+
+    // Interpolate from hitColor (color the button was assigned when pressed) back to the theme color
+    SetPixel(frame, i, BlendColor(hitColor[i], color, times[i]));
+    markSettled(i);
   }
   return true;
 }
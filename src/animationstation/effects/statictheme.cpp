@@ -310,33 +310,43 @@ bool StaticTheme::Animate(RGB (&frame)[100]) {
     UpdateTime();
     UpdatePresses(frame);
 
-    for (size_t r = 0; r != matrix->pixels.size(); r++) {
-      for (size_t c = 0; c != matrix->pixels[r].size(); c++) {
-        if (matrix->pixels[r][c].index == NO_PIXEL.index)
-          continue;
-
-        // Count down the timer
-        DecrementFadeCounter(matrix->pixels[r][c].index);
-
-        std::map<uint32_t, RGB> theme = themes.at(animationOptions.themeIndex);
-
-        auto itr = theme.find(matrix->pixels[r][c].mask);
-        if (itr != theme.end()) {
-          for (size_t p = 0; p != matrix->pixels[r][c].positions.size(); p++) {
-            // Interpolate from hitColor (color the button was assigned when pressed) back to the theme color
-            frame[matrix->pixels[r][c].positions[p]] = BlendColor(hitColor[matrix->pixels[r][c].index], itr->second, times[matrix->pixels[r][c].index]);
-          }
-        } else {
-          for (size_t p = 0; p != matrix->pixels[r][c].positions.size(); p++) {
-            frame[matrix->pixels[r][c].positions[p]] = defaultColor;
-          }
-        }
+    if (animationOptions.themeIndex != appliedThemeIndex)
+      ApplyTheme(animationOptions.themeIndex);
+
+    for (uint8_t i = 0; i < matrix->pixelCount; i++) {
+      if (isSettled(i))
+        continue;
+
+      // Count down the timer
+      DecrementFadeCounter(i);
+
+      if (themedPixels & (1u << i)) {
+        // Interpolate from hitColor (color the button was assigned when pressed) back to the theme color
+        SetPixel(frame, i, BlendColor(hitColor[i], pixelColors[i], times[i]));
+      } else {
+        SetPixel(frame, i, defaultColor);
       }
+      markSettled(i);
     }
   }
   return true;
 }
 
+// Look each pixel's color up once instead of on every frame
+void StaticTheme::ApplyTheme(uint32_t themeIndex) {
+  const std::map<uint32_t, RGB> & theme = themes.at(themeIndex);
+  themedPixels = 0;
+  for (uint8_t i = 0; i < matrix->pixelCount; i++) {
+    auto itr = theme.find(matrix->masks[i]);
+    if (itr != theme.end()) {
+      pixelColors[i] = itr->second;
+      themedPixels |= (1u << i);
+    }
+  }
+  appliedThemeIndex = themeIndex;
+  settledPixels = 0;
+}
+
 void StaticTheme::ParameterUp() {
   AnimationOptions & animationOptions = Storage::getInstance().getAnimationOptions();
   if (animationOptions.themeIndex < StaticTheme::themes.size() - 1) {
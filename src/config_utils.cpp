@@ -37,11 +37,14 @@
 
 #include "CRC32.h"
 #include "FlashPROM.h"
+#include "FlashJournal.h"
 #include "base64.h"
 
 #include <ArduinoJson.h>
 
+#include <algorithm>
 #include <cassert>
+#include <cstdio>
 #include <cstring>
 #include <memory>
 
@@ -124,6 +127,18 @@
     #define DEFAULT_DEBOUNCE_DELAY 5
 #endif
 
+#ifndef DEFAULT_DEBOUNCE_MODE
+    #define DEFAULT_DEBOUNCE_MODE DEBOUNCE_MODE_POLLED
+#endif
+
+#ifndef DEFAULT_DEBOUNCE_EAGER_PINS
+    #define DEFAULT_DEBOUNCE_EAGER_PINS 0
+#endif
+
+#ifndef DEFAULT_FRAME_SYNCED_REPORTS
+    #define DEFAULT_FRAME_SYNCED_REPORTS false
+#endif
+
 #ifndef DEFAULT_PS4_REPORTHACK
     #define DEFAULT_PS4_REPORTHACK false
 #endif
@@ -298,6 +313,9 @@ void ConfigUtils::initUnsetPropertiesWithDefaults(Config& config)
     INIT_UNSET_PROPERTY(config.gamepadOptions, profileNumber, 1);
     INIT_UNSET_PROPERTY(config.gamepadOptions, ps4ControllerType, DEFAULT_PS4CONTROLLER_TYPE);
     INIT_UNSET_PROPERTY(config.gamepadOptions, debounceDelay, DEFAULT_DEBOUNCE_DELAY);
+    INIT_UNSET_PROPERTY(config.gamepadOptions, debounceMode, DEFAULT_DEBOUNCE_MODE);
+    INIT_UNSET_PROPERTY(config.gamepadOptions, debounceEagerPins, DEFAULT_DEBOUNCE_EAGER_PINS);
+    INIT_UNSET_PROPERTY(config.gamepadOptions, frameSyncedReports, DEFAULT_FRAME_SYNCED_REPORTS);
     INIT_UNSET_PROPERTY(config.gamepadOptions, inputModeB1, DEFAULT_INPUT_MODE_B1);
     INIT_UNSET_PROPERTY(config.gamepadOptions, inputModeB2, DEFAULT_INPUT_MODE_B2);
     INIT_UNSET_PROPERTY(config.gamepadOptions, inputModeB3, DEFAULT_INPUT_MODE_B3);
@@ -742,6 +760,7 @@ void ConfigUtils::initUnsetPropertiesWithDefaults(Config& config)
     // addonOptions.pcf8575Options
     INIT_UNSET_PROPERTY(config.addonOptions.pcf8575Options, enabled, I2C_PCF8575_ENABLED);
     INIT_UNSET_PROPERTY(config.addonOptions.pcf8575Options, deprecatedI2cBlock, (I2C_PCF8575_BLOCK == i2c0) ? 0 : 1);
+    INIT_UNSET_PROPERTY(config.addonOptions.pcf8575Options, interruptPin, I2C_PCF8575_INTERRUPT_PIN);
 
     GpioAction pcf8575Actions[PCF8575_PIN_COUNT] = {
         PCF8575_PIN00_ACTION,PCF8575_PIN01_ACTION,PCF8575_PIN02_ACTION,PCF8575_PIN03_ACTION,
@@ -1611,10 +1630,129 @@ static bool loadConfigInner(Config& config)
     return pb_decode(&inputStream, Config_fields, &config);
 }
 
-void ConfigUtils::load(Config& config)
+// Newer firmware keeps the config in a FlashJournal instead: a snapshot of the whole encoded Config, followed by
+// deltas that each hold only the top-level Config fields that changed. Flipping the SOCD mode from a hotkey then
+// appends a record with just gamepadOptions in it rather than rewriting the whole block. Fields are compared by
+// the CRC of their encoded bytes, so a save that doesn't change anything doesn't write anything.
+
+#define CONFIG_JOURNAL_MAX_FIELDS 32    // top-level Config field numbers must stay below this
+#define CONFIG_JOURNAL_MAX_DELTAS 64    // write a fresh snapshot after this many deltas to bound the replay at boot
+
+static FlashJournal configJournal;
+static uint32_t journalFieldCrcs[CONFIG_JOURNAL_MAX_FIELDS];
+static uint32_t journalFieldMask = 0;
+
+// Calls back with the tag and byte range of every top-level field in an encoded Config
+template <typename Callback>
+static bool forEachConfigField(const uint8_t* data, size_t dataSize, Callback callback)
 {
-    // First try to load from Protobuf storage, if that fails fall back to legacy storage.
-    const bool loaded = loadConfigInner(config) | fromLegacyStorage(config);
+    pb_istream_t stream = pb_istream_from_buffer(data, dataSize);
+    while (stream.bytes_left > 0)
+    {
+        const size_t start = dataSize - stream.bytes_left;
+        pb_wire_type_t wireType;
+        uint32_t tag;
+        bool eof;
+        if (!pb_decode_tag(&stream, &wireType, &tag, &eof))
+        {
+            return eof;
+        }
+        if (!pb_skip_field(&stream, wireType))
+        {
+            return false;
+        }
+        callback(tag, start, dataSize - stream.bytes_left - start);
+    }
+    return true;
+}
+
+// Replaces the top-level fields contained in a delta, leaving everything else as it is
+static bool applyConfigDelta(Config& config, const uint8_t* data, size_t dataSize)
+{
+    bool success = true;
+    forEachConfigField(data, dataSize, [&](uint32_t tag, size_t start, size_t size)
+    {
+        pb_field_iter_t iter;
+        if (!success || !pb_field_iter_begin(&iter, Config_fields, &config) || !pb_field_iter_find(&iter, tag))
+        {
+            return;
+        }
+
+        pb_istream_t stream = pb_istream_from_buffer(data + start, size);
+        if (PB_LTYPE_IS_SUBMSG(iter.type))
+        {
+            // Decode the sub-message on its own so it starts from its defaults instead of merging into
+            // the old value, otherwise repeated fields would be appended to
+            pb_wire_type_t wireType;
+            uint32_t fieldTag;
+            bool eof;
+            pb_istream_t substream;
+            success = pb_decode_tag(&stream, &wireType, &fieldTag, &eof) &&
+                      pb_make_string_substream(&stream, &substream) &&
+                      pb_decode(&substream, iter.submsg_desc, iter.pData) &&
+                      pb_close_string_substream(&stream, &substream);
+            if (success && iter.pSize != nullptr)
+            {
+                *reinterpret_cast<bool*>(iter.pSize) = true;
+            }
+        }
+        else
+        {
+            success = pb_decode_ex(&stream, Config_fields, &config, PB_DECODE_NOINIT);
+        }
+    });
+    return success;
+}
+
+static void updateJournalFieldCrcs(const uint8_t* data, size_t dataSize, uint32_t* fieldCrcs, uint32_t& fieldMask)
+{
+    forEachConfigField(data, dataSize, [&](uint32_t tag, size_t start, size_t size)
+    {
+        if (tag < CONFIG_JOURNAL_MAX_FIELDS)
+        {
+            fieldCrcs[tag] = CRC32::calculate(data + start, size);
+            fieldMask |= 1u << tag;
+        }
+    });
+}
+
+static bool loadConfigJournal(Config& config)
+{
+    config = Config Config_init_zero;
+    journalFieldMask = 0;
+
+    if (!configJournal.open())
+    {
+        return false;
+    }
+
+    FlashJournalRecord record;
+    for (bool found = configJournal.first(record); found; found = configJournal.next(record))
+    {
+        if (record.type == FLASH_JOURNAL_SNAPSHOT)
+        {
+            pb_istream_t inputStream = pb_istream_from_buffer(record.data(), record.dataSize);
+            if (!pb_decode(&inputStream, Config_fields, &config))
+            {
+                return false;
+            }
+            journalFieldMask = 0;
+        }
+        else if (!applyConfigDelta(config, record.data(), record.dataSize))
+        {
+            return false;
+        }
+        updateJournalFieldCrcs(record.data(), record.dataSize, journalFieldCrcs, journalFieldMask);
+    }
+
+    return true;
+}
+
+bool ConfigUtils::load(Config& config)
+{
+    // First try the journal, then the single block Protobuf storage, and if both fail fall back to legacy storage.
+    const bool fromJournal = loadConfigJournal(config);
+    const bool loaded = fromJournal || loadConfigInner(config) || fromLegacyStorage(config);
 
     if (!loaded)
     {
@@ -1650,13 +1788,18 @@ void ConfigUtils::load(Config& config)
     // Migrate old JS slider add-on to core
     migrateJSliderToCore(config);
 
+    // Migrations only ever change something the first time a firmware version sees a config. If this version
+    // already saved it to the journal there is nothing new to persist.
+    const bool versionChanged = !config.has_boardVersion ||
+        strncmp(config.boardVersion, GP2040VERSION, sizeof(config.boardVersion) - 1) != 0;
+
     // Update boardVersion, in case we migrated from an older version
     strncpy(config.boardVersion, GP2040VERSION, sizeof(config.boardVersion));
     config.boardVersion[sizeof(config.boardVersion) - 1] = '\0';
     config.has_boardVersion = true;
 
-    // Save, to make sure we persist any performed migration steps
-    save(config);
+    // Leave the save to the caller, so it can happen once USB is up instead of holding up boot
+    return !fromJournal || versionChanged || configJournal.hasStaleRecords();
 }
 
 static void setHasFlags(const pb_msgdesc_t* fields, void* s)
@@ -1731,107 +1874,180 @@ bool ConfigUtils::save(Config& config)
     // its default value.
     setHasFlags(Config_fields, &config);
 
-    // Encode the data directly into the cache of FlashPROM
-    pb_ostream_t outputStream = pb_ostream_from_buffer(EEPROM.writeCache, EEPROM_SIZE_BYTES - sizeof(ConfigFooter));
+    // The previous save may still be programming out of the cache
+    EEPROM.flush();
+
+    // Encode the data into the cache of FlashPROM, behind the space for the journal record header
+    uint8_t* data = EEPROM.writeCache + sizeof(FlashJournalHeader);
+    pb_ostream_t outputStream = pb_ostream_from_buffer(data, EEPROM_SIZE_BYTES - FlashJournal::recordSize(0));
     if (!pb_encode(&outputStream, Config_fields, &config))
     {
         return false;
     }
+    const size_t dataSize = outputStream.bytes_written;
+
+    // Find the top-level fields that changed since the last save
+    uint32_t fieldCrcs[CONFIG_JOURNAL_MAX_FIELDS];
+    uint32_t fieldMask = 0;
+    updateJournalFieldCrcs(data, dataSize, fieldCrcs, fieldMask);
 
-    // Create the new footer
-    ConfigFooter newFooter;
-    newFooter.dataSize = outputStream.bytes_written;
-    newFooter.dataCrc = CRC32::calculate(EEPROM.writeCache, newFooter.dataSize);
-    newFooter.magic = FOOTER_MAGIC;
+    uint32_t changedMask = fieldMask ^ journalFieldMask;
+    size_t deltaSize = 0;
+    forEachConfigField(data, dataSize, [&](uint32_t tag, size_t start, size_t size)
+    {
+        if (tag >= CONFIG_JOURNAL_MAX_FIELDS || fieldCrcs[tag] != journalFieldCrcs[tag] || (changedMask & (1u << tag)))
+        {
+            changedMask |= (tag < CONFIG_JOURNAL_MAX_FIELDS) ? (1u << tag) : 1u;
+            deltaSize += size;
+        }
+    });
 
-    // The data has changed when the footer content has changed. Only then do we acutally need to save.
-    const ConfigFooter& oldFooter = *reinterpret_cast<ConfigFooter*>(EEPROM.writeCache + EEPROM_SIZE_BYTES - sizeof(ConfigFooter));
-    if (newFooter == oldFooter)
+    const bool haveSnapshot = configJournal.hasSnapshot() && !configJournal.hasStaleRecords();
+    if (haveSnapshot && changedMask == 0)
     {
         // The data has not changed, no saving neccessary.
         return true;
     }
 
-    // Write the footer
-    ConfigFooter* cacheFooter = reinterpret_cast<ConfigFooter*>(EEPROM.writeCache + EEPROM_SIZE_BYTES - sizeof(ConfigFooter));
-    memcpy(cacheFooter, &newFooter, sizeof(ConfigFooter));
+    // Append only the changed fields, as long as that still leaves room for the next snapshot. Dropped fields
+    // can't be expressed as a delta, they need a snapshot.
+    bool written = false;
+    if (haveSnapshot &&
+        (journalFieldMask & ~fieldMask) == 0 &&
+        configJournal.getDeltaCount() < CONFIG_JOURNAL_MAX_DELTAS &&
+        configJournal.canAppend(deltaSize + FlashJournal::recordSize(dataSize)))
+    {
+        // Pack the changed fields down to the start of the data. Each one only moves over fields we've already read.
+        size_t deltaEnd = 0;
+        forEachConfigField(data, dataSize, [&](uint32_t tag, size_t start, size_t size)
+        {
+            if (tag >= CONFIG_JOURNAL_MAX_FIELDS || (changedMask & (1u << tag)))
+            {
+                memmove(data + deltaEnd, data + start, size);
+                deltaEnd += size;
+            }
+        });
+
+        written = configJournal.append(FLASH_JOURNAL_DELTA, EEPROM.writeCache, deltaEnd);
+        if (!written)
+        {
+            // The packing destroyed the full encoding, redo it for the snapshot
+            outputStream = pb_ostream_from_buffer(data, EEPROM_SIZE_BYTES - FlashJournal::recordSize(0));
+            if (!pb_encode(&outputStream, Config_fields, &config))
+            {
+                return false;
+            }
+        }
+    }
 
-    // Move the encoded data in memory down to the footer
-    memmove(EEPROM.writeCache + EEPROM_SIZE_BYTES - sizeof(ConfigFooter) - newFooter.dataSize, EEPROM.writeCache, newFooter.dataSize);
-    memset(EEPROM.writeCache, 0, EEPROM_SIZE_BYTES - sizeof(ConfigFooter) - newFooter.dataSize);
+    if (!written)
+    {
+        written = configJournal.append(FLASH_JOURNAL_SNAPSHOT, EEPROM.writeCache, dataSize) ||
+                  configJournal.rewrite(EEPROM.writeCache, dataSize);
+    }
 
-    EEPROM.commit();
+    if (written)
+    {
+        memcpy(journalFieldCrcs, fieldCrcs, sizeof(journalFieldCrcs));
+        journalFieldMask = fieldMask;
+    }
 
-    return true;
+    return written;
 }
 
 // -----------------------------------------------------
 // To JSON
 // -----------------------------------------------------
 
-static void writeIndentation(std::string& str, int level)
+static void __attribute__((noinline)) append(ConfigUtils::StreamWriter& out, const char* str)
 {
-    str.append(static_cast<std::string::size_type>(level), '\t');
+    out.write(str, strlen(str));
 }
 
-// Don't inline this function, we do not want to consume stack space in the calling function
-static void __attribute__((noinline)) appendAsString(std::string& str, double value)
+static void append(ConfigUtils::StreamWriter& out, char c)
 {
-    str.append(std::to_string(value));
+    out.write(&c, 1);
 }
 
-// Don't inline this function, we do not want to consume stack space in the calling function
-static void __attribute__((noinline)) appendAsString(std::string& str, float value)
+static void writeIndentation(ConfigUtils::StreamWriter& out, int level)
 {
-    str.append(std::to_string(value));
+    static const char tabs[] = "\t\t\t\t\t\t\t\t";
+    for (; level > 0; level -= sizeof(tabs) - 1)
+        out.write(tabs, std::min<size_t>(level, sizeof(tabs) - 1));
 }
 
-// Don't inline this function, we do not want to consume stack space in the calling function
-static void __attribute__((noinline)) appendAsString(std::string& str, int32_t value)
+// Same text as std::to_string(), without the temporary string
+template <typename T>
+static void __attribute__((noinline)) appendFormatted(ConfigUtils::StreamWriter& out, const char* format, T value)
 {
-    str.append(std::to_string(value));
+    char buffer[48];
+    int length = snprintf(buffer, sizeof(buffer), format, value);
+    if (length >= static_cast<int>(sizeof(buffer)))
+        append(out, std::to_string(value).c_str());
+    else if (length > 0)
+        out.write(buffer, length);
 }
 
-// Don't inline this function, we do not want to consume stack space in the calling function
-static void __attribute__((noinline)) appendAsString(std::string& str, uint32_t value)
+static void appendAsString(ConfigUtils::StreamWriter& out, double value) { appendFormatted(out, "%f", value); }
+static void appendAsString(ConfigUtils::StreamWriter& out, float value) { appendFormatted(out, "%f", static_cast<double>(value)); }
+static void appendAsString(ConfigUtils::StreamWriter& out, int32_t value) { appendFormatted(out, "%ld", static_cast<long>(value)); }
+static void appendAsString(ConfigUtils::StreamWriter& out, uint32_t value) { appendFormatted(out, "%lu", static_cast<unsigned long>(value)); }
+
+// Base64 in slices of whole 3 byte groups, only the last slice gets padding so the output is the
+// same as encoding everything in one go
+static void __attribute__((noinline)) appendAsBase64(ConfigUtils::StreamWriter& out, const uint8_t* bytes, size_t size)
 {
-    str.append(std::to_string(value));
+    const size_t sliceSize = 48;
+    for (size_t offset = 0; offset < size; offset += sliceSize)
+    {
+        std::string encoded = Base64::Encode(reinterpret_cast<const char*>(bytes) + offset, std::min(sliceSize, size - offset));
+        out.write(encoded.data(), encoded.size());
+    }
 }
 
-#define TO_JSON_ENUM(fieldname, submessageType) appendAsString(str, static_cast<int32_t>(s.fieldname));
-#define TO_JSON_UENUM(fieldname, submessageType) appendAsString(str, static_cast<uint32_t>(s.fieldname));
-#define TO_JSON_DOUBLE(fieldname, submessageType) appendAsString(str, static_cast<double>(s.fieldname));
-#define TO_JSON_FLOAT(fieldname, submessageType) appendAsString(str, static_cast<float>(s.fieldname));
-#define TO_JSON_INT32(fieldname, submessageType) appendAsString(str, s.fieldname);
-#define TO_JSON_UINT32(fieldname, submessageType) appendAsString(str, s.fieldname);
-#define TO_JSON_BOOL(fieldname, submessageType) str.append((s.fieldname) ? "true" : "false");
-#define TO_JSON_STRING(fieldname, submessageType) str.push_back('"'); str.append(s.fieldname); str.push_back('"');
-#define TO_JSON_BYTES(fieldname, submessageType) str.push_back('"'); str.append(Base64::Encode(reinterpret_cast<const char*>(s.fieldname.bytes), s.fieldname.size)); str.push_back('"');
-#define TO_JSON_MESSAGE(fieldname, submessageType) PREPROCESSOR_JOIN(toJSON, submessageType)(str, s.fieldname, indentLevel + 1);
-
-#define TO_JSON_REPEATED_ENUM(fieldname, submessageType) appendAsString(str, static_cast<int32_t>(s.fieldname[i]));
-#define TO_JSON_REPEATED_UENUM(fieldname, submessageType) appendAsString(str, static_cast<uint32_t>(s.fieldname[i]));
-#define TO_JSON_REPEATED_DOUBLE(fieldname, submessageType) appendAsString(str, static_cast<double>(s.fieldname[i]));
-#define TO_JSON_REPEATED_FLOAT(fieldname, submessageType) appendAsString(str, static_cast<float>(s.fieldname[i]));
-#define TO_JSON_REPEATED_INT32(fieldname, submessageType) appendAsString(str, s.fieldname[i]);
-#define TO_JSON_REPEATED_UINT32(fieldname, submessageType) appendAsString(str, s.fieldname[i]);
-#define TO_JSON_REPEATED_BOOL(fieldname, submessageType) str.append((s.fieldname[i]) ? "true" : "false");
-#define TO_JSON_REPEATED_STRING(fieldname, submessageType) str.push_back('"'); str.append(s.fieldname[i]); str.push_back('"');
+class StringWriter : public ConfigUtils::StreamWriter
+{
+public:
+    StringWriter(std::string& str) : str(str) {}
+    virtual void write(const char* data, size_t length) { str.append(data, length); }
+private:
+    std::string& str;
+};
+
+#define TO_JSON_ENUM(fieldname, submessageType) appendAsString(out, static_cast<int32_t>(s.fieldname));
+#define TO_JSON_UENUM(fieldname, submessageType) appendAsString(out, static_cast<uint32_t>(s.fieldname));
+#define TO_JSON_DOUBLE(fieldname, submessageType) appendAsString(out, static_cast<double>(s.fieldname));
+#define TO_JSON_FLOAT(fieldname, submessageType) appendAsString(out, static_cast<float>(s.fieldname));
+#define TO_JSON_INT32(fieldname, submessageType) appendAsString(out, s.fieldname);
+#define TO_JSON_UINT32(fieldname, submessageType) appendAsString(out, s.fieldname);
+#define TO_JSON_BOOL(fieldname, submessageType) append(out, (s.fieldname) ? "true" : "false");
+#define TO_JSON_STRING(fieldname, submessageType) append(out, '"'); append(out, s.fieldname); append(out, '"');
+#define TO_JSON_BYTES(fieldname, submessageType) append(out, '"'); appendAsBase64(out, s.fieldname.bytes, s.fieldname.size); append(out, '"');
+#define TO_JSON_MESSAGE(fieldname, submessageType) PREPROCESSOR_JOIN(toJSON, submessageType)(out, s.fieldname, indentLevel + 1);
+
+#define TO_JSON_REPEATED_ENUM(fieldname, submessageType) appendAsString(out, static_cast<int32_t>(s.fieldname[i]));
+#define TO_JSON_REPEATED_UENUM(fieldname, submessageType) appendAsString(out, static_cast<uint32_t>(s.fieldname[i]));
+#define TO_JSON_REPEATED_DOUBLE(fieldname, submessageType) appendAsString(out, static_cast<double>(s.fieldname[i]));
+#define TO_JSON_REPEATED_FLOAT(fieldname, submessageType) appendAsString(out, static_cast<float>(s.fieldname[i]));
+#define TO_JSON_REPEATED_INT32(fieldname, submessageType) appendAsString(out, s.fieldname[i]);
+#define TO_JSON_REPEATED_UINT32(fieldname, submessageType) appendAsString(out, s.fieldname[i]);
+#define TO_JSON_REPEATED_BOOL(fieldname, submessageType) append(out, (s.fieldname[i]) ? "true" : "false");
+#define TO_JSON_REPEATED_STRING(fieldname, submessageType) append(out, '"'); append(out, s.fieldname[i]); append(out, '"');
 #define TO_JSON_REPEATED_BYTES(fieldname, submessageType) static_assert(false, "not supported");
-#define TO_JSON_REPEATED_MESSAGE(fieldname, submessageType) PREPROCESSOR_JOIN(toJSON, submessageType)(str, s.fieldname[i], indentLevel + 1);
+#define TO_JSON_REPEATED_MESSAGE(fieldname, submessageType) PREPROCESSOR_JOIN(toJSON, submessageType)(out, s.fieldname[i], indentLevel + 1);
 
 #define TO_JSON_REPEATED(ltype, fieldname, submessageType) \
-    str.append("["); \
+    append(out, "["); \
     for (int i = 0; i < s.PREPROCESSOR_JOIN(fieldname, _count); ++i) \
     { \
-        if (i != 0) str.append(",");\
-        str.append("\n"); \
-        writeIndentation(str, indentLevel + 1); \
+        if (i != 0) append(out, ",");\
+        append(out, "\n"); \
+        writeIndentation(out, indentLevel + 1); \
         PREPROCESSOR_JOIN(TO_JSON_REPEATED_, ltype)(fieldname, submessageType) \
     } \
-    str.append("\n"); \
-    writeIndentation(str, indentLevel); \
-    str.append("]"); \
+    append(out, "\n"); \
+    writeIndentation(out, indentLevel); \
+    append(out, "]"); \
 
 #define TO_JSON_REQUIRED(ltype, fieldname, submessageType) PREPROCESSOR_JOIN(TO_JSON_, ltype)(fieldname, submessageType)
 #define TO_JSON_OPTIONAL(ltype, fieldname, submessageType) PREPROCESSOR_JOIN(TO_JSON_, ltype)(fieldname, submessageType)
@@ -1844,26 +2060,26 @@ static void __attribute__((noinline)) appendAsString(std::string& str, uint32_t
 #define TO_JSON_CALLBACK(htype, ltype, fieldname, submessageType) static_assert(false, "not supported");
 
 #define TO_JSON_FIELD(parenttype, atype, htype, ltype, fieldname, tag, disallow_export) \
-    if (!disallow_export) \
+    if (!disallow_export && !out.finished) \
     { \
-        if (!firstField) str.append(",\n"); \
+        if (!firstField) append(out, ",\n"); \
         firstField = false; \
-        writeIndentation(str, indentLevel); \
-        str.append("\"" #fieldname "\": "); \
+        writeIndentation(out, indentLevel); \
+        append(out, "\"" #fieldname "\": "); \
         PREPROCESSOR_JOIN(TO_JSON_, atype)(htype, ltype, fieldname, parenttype ## _ ## fieldname ## _MSGTYPE) \
     }
 
-#define GEN_TO_JSON_FUNCTION_DECL(structtype) static void toJSON ## structtype(std::string& str, const structtype& s, int indentLevel);
+#define GEN_TO_JSON_FUNCTION_DECL(structtype) static void toJSON ## structtype(ConfigUtils::StreamWriter& out, const structtype& s, int indentLevel);
 
 #define GEN_TO_JSON_FUNCTION(structtype) \
-    static void toJSON ## structtype(std::string& str, const structtype& s, int indentLevel) \
+    static void toJSON ## structtype(ConfigUtils::StreamWriter& out, const structtype& s, int indentLevel) \
     { \
         bool firstField = true; \
-        str.append("{\n"); \
+        append(out, "{\n"); \
         structtype ## _FIELDLIST(TO_JSON_FIELD, structtype) \
-        str.push_back('\n'); \
-        writeIndentation(str, indentLevel - 1); \
-        str.push_back('}'); \
+        append(out, '\n'); \
+        writeIndentation(out, indentLevel - 1); \
+        append(out, '}'); \
     } \
 
 #if defined(CONFIG_MESSAGES_GP2040)
@@ -1875,12 +2091,55 @@ static void __attribute__((noinline)) appendAsString(std::string& str, uint32_t
     ENUM_MESSAGES_GP2040(GEN_TO_JSON_FUNCTION)
 #endif
 
+void ConfigUtils::toJSON(const Config& config, StreamWriter& writer)
+{
+    toJSONConfig(writer, config, 1);
+    append(writer, '\n');
+}
+
+// toJSONConfig() one part at a time: the opening brace, each top-level field, then the closing brace
+#define TO_JSON_CONFIG_PART(parenttype, atype, htype, ltype, fieldname, tag, disallow_export) \
+    if (partIndex == part++) \
+    { \
+        TO_JSON_FIELD(parenttype, atype, htype, ltype, fieldname, tag, disallow_export) \
+        return true; \
+    } \
+    firstField = firstField && disallow_export;
+
+static bool toJSONConfigPart(ConfigUtils::StreamWriter& out, const Config& s, uint32_t partIndex)
+{
+    const int indentLevel = 1;
+    bool firstField = true;
+    uint32_t part = 0;
+    if (partIndex == part++)
+    {
+        append(out, "{\n");
+        return true;
+    }
+    Config_FIELDLIST(TO_JSON_CONFIG_PART, Config)
+    if (partIndex == part++)
+    {
+        append(out, "\n}\n");
+        return true;
+    }
+    return false;
+}
+
+bool ConfigUtils::toJSON(const Config& config, StreamPosition& position, StreamWriter& writer)
+{
+    if (!toJSONConfigPart(writer, config, position.part))
+        return false;
+    if (!writer.finished)
+        position.part++;
+    return true;
+}
+
 std::string ConfigUtils::toJSON(const Config& config)
 {
     std::string str;
     str.reserve(1024 * 4);
-    toJSONConfig(str, config, 1);
-    str.push_back('\n');
+    StringWriter writer(str);
+    toJSON(config, writer);
 
     return str;
 }
@@ -2286,3 +2545,252 @@ bool ConfigUtils::fromJSON(Config& config, const char* data, size_t dataLen)
 
     return true;
 }
+
+// -----------------------------------------------------
+// To/From Protobuf
+// -----------------------------------------------------
+
+// Only message fields can be fetched or replaced on their own
+#define CONFIG_SECTION_MESSAGE(fieldname, tag) { #fieldname, tag },
+#define CONFIG_SECTION_BOOL(fieldname, tag)
+#define CONFIG_SECTION_INT32(fieldname, tag)
+#define CONFIG_SECTION_UINT32(fieldname, tag)
+#define CONFIG_SECTION_ENUM(fieldname, tag)
+#define CONFIG_SECTION_UENUM(fieldname, tag)
+#define CONFIG_SECTION_FLOAT(fieldname, tag)
+#define CONFIG_SECTION_DOUBLE(fieldname, tag)
+#define CONFIG_SECTION_STRING(fieldname, tag)
+#define CONFIG_SECTION_BYTES(fieldname, tag)
+#define CONFIG_SECTION_NAME(parenttype, atype, htype, ltype, fieldname, tag, disallow_export) PREPROCESSOR_JOIN(CONFIG_SECTION_, ltype)(fieldname, tag)
+
+static const struct { const char* name; uint32_t tag; } configSections[] =
+{
+    Config_FIELDLIST(CONFIG_SECTION_NAME, Config)
+};
+
+static bool findSection(const Config& config, uint32_t tag, pb_field_iter_t& field)
+{
+    return pb_field_iter_begin_const(&field, Config_fields, &config) &&
+        pb_field_iter_find(&field, tag) &&
+        PB_LTYPE_IS_SUBMSG(field.type) &&
+        PB_HTYPE(field.type) != PB_HTYPE_REPEATED;
+}
+
+// Fields marked disallow_export (the PS4 keys) stay on the device, as with toJSON: a backup is
+// encoded from a copy with them cleared (src == nullptr) and a restore copies them over from the
+// current config (src). Messages further down are walked for more of them.
+#define UNEXPORTED_DATA(fieldname) \
+    if (src != nullptr) memcpy(&dst.fieldname, &src->fieldname, sizeof(dst.fieldname)); \
+    else memset(&dst.fieldname, 0, sizeof(dst.fieldname));
+#define UNEXPORTED_OPTIONAL(fieldname) \
+    dst.PREPROCESSOR_JOIN(has_, fieldname) = (src != nullptr) && src->PREPROCESSOR_JOIN(has_, fieldname); \
+    UNEXPORTED_DATA(fieldname)
+#define UNEXPORTED_REPEATED(fieldname) \
+    dst.PREPROCESSOR_JOIN(fieldname, _count) = (src != nullptr) ? src->PREPROCESSOR_JOIN(fieldname, _count) : 0; \
+    UNEXPORTED_DATA(fieldname)
+#define UNEXPORTED_REQUIRED(fieldname) static_assert(false, "not supported");
+#define UNEXPORTED_SINGULAR(fieldname) static_assert(false, "not supported");
+#define UNEXPORTED_FIXARRAY(fieldname) static_assert(false, "not supported");
+#define UNEXPORTED_ONEOF(fieldname) static_assert(false, "not supported");
+
+#define UNEXPORTED_NESTED_MESSAGE_OPTIONAL(fieldname, submessageType) \
+    PREPROCESSOR_JOIN(keepUnexported, submessageType)(dst.fieldname, (src != nullptr) ? &src->fieldname : nullptr);
+#define UNEXPORTED_NESTED_MESSAGE_REQUIRED(fieldname, submessageType) UNEXPORTED_NESTED_MESSAGE_OPTIONAL(fieldname, submessageType)
+#define UNEXPORTED_NESTED_MESSAGE_REPEATED(fieldname, submessageType) \
+    for (int i = 0; i < dst.PREPROCESSOR_JOIN(fieldname, _count); ++i) \
+        PREPROCESSOR_JOIN(keepUnexported, submessageType)(dst.fieldname[i], \
+            (src != nullptr && i < src->PREPROCESSOR_JOIN(fieldname, _count)) ? &src->fieldname[i] : nullptr);
+#define UNEXPORTED_NESTED_MESSAGE_SINGULAR(fieldname, submessageType) static_assert(false, "not supported");
+#define UNEXPORTED_NESTED_MESSAGE_FIXARRAY(fieldname, submessageType) static_assert(false, "not supported");
+#define UNEXPORTED_NESTED_MESSAGE_ONEOF(fieldname, submessageType) static_assert(false, "not supported");
+
+#define UNEXPORTED_NESTED_MESSAGE(htype, fieldname, submessageType) PREPROCESSOR_JOIN(UNEXPORTED_NESTED_MESSAGE_, htype)(fieldname, submessageType)
+#define UNEXPORTED_NESTED_BOOL(htype, fieldname, submessageType)
+#define UNEXPORTED_NESTED_INT32(htype, fieldname, submessageType)
+#define UNEXPORTED_NESTED_UINT32(htype, fieldname, submessageType)
+#define UNEXPORTED_NESTED_ENUM(htype, fieldname, submessageType)
+#define UNEXPORTED_NESTED_UENUM(htype, fieldname, submessageType)
+#define UNEXPORTED_NESTED_FLOAT(htype, fieldname, submessageType)
+#define UNEXPORTED_NESTED_DOUBLE(htype, fieldname, submessageType)
+#define UNEXPORTED_NESTED_STRING(htype, fieldname, submessageType)
+#define UNEXPORTED_NESTED_BYTES(htype, fieldname, submessageType)
+
+// disallow_export is 0 or 1, so only the matching variant gets expanded
+#define UNEXPORTED_FIELD_0(htype, ltype, fieldname, submessageType) PREPROCESSOR_JOIN(UNEXPORTED_NESTED_, ltype)(htype, fieldname, submessageType)
+#define UNEXPORTED_FIELD_1(htype, ltype, fieldname, submessageType) PREPROCESSOR_JOIN(UNEXPORTED_, htype)(fieldname)
+
+#define UNEXPORTED_FIELD(parenttype, atype, htype, ltype, fieldname, tag, disallow_export) \
+    PREPROCESSOR_JOIN(UNEXPORTED_FIELD_, disallow_export)(htype, ltype, fieldname, parenttype ## _ ## fieldname ## _MSGTYPE)
+
+#define GEN_KEEP_UNEXPORTED_FUNCTION_DECL(structtype) static void keepUnexported ## structtype(structtype& dst, const structtype* src);
+
+#define GEN_KEEP_UNEXPORTED_FUNCTION(structtype) \
+    static void keepUnexported ## structtype(structtype& dst, const structtype* src) \
+    { \
+        (void)dst; (void)src; \
+        structtype ## _FIELDLIST(UNEXPORTED_FIELD, structtype) \
+    }
+
+#if defined(CONFIG_MESSAGES_GP2040)
+    CONFIG_MESSAGES_GP2040(GEN_KEEP_UNEXPORTED_FUNCTION_DECL)
+    CONFIG_MESSAGES_GP2040(GEN_KEEP_UNEXPORTED_FUNCTION)
+#endif
+#if defined(ENUM_MESSAGES_GP2040)
+    ENUM_MESSAGES_GP2040(GEN_KEEP_UNEXPORTED_FUNCTION_DECL)
+    ENUM_MESSAGES_GP2040(GEN_KEEP_UNEXPORTED_FUNCTION)
+#endif
+
+uint32_t ConfigUtils::findProtobufSection(const char* name)
+{
+    for (const auto& section : configSections)
+    {
+        if (strcmp(section.name, name) == 0)
+            return section.tag;
+    }
+    return 0;
+}
+
+struct ProtobufOutput
+{
+    ConfigUtils::StreamWriter& writer;
+    CRC32 crc;
+};
+
+static bool writeProtobufOutput(pb_ostream_t* stream, const pb_byte_t* buf, size_t count)
+{
+    ProtobufOutput& output = *static_cast<ProtobufOutput*>(stream->state);
+    output.crc.update(buf, count);
+    output.writer.write(reinterpret_cast<const char*>(buf), count);
+    return !output.writer.finished;
+}
+
+#define CONFIG_FIELD_TAG(parenttype, atype, htype, ltype, fieldname, tag, disallow_export) tag,
+
+static const uint32_t configFieldTags[] =
+{
+    Config_FIELDLIST(CONFIG_FIELD_TAG, Config)
+};
+
+// The whole Config goes out a top-level field per part, a section as a single part, then the CRC trailer
+static uint32_t protobufPartCount(uint32_t tag)
+{
+    return ((tag != 0) ? 1 : sizeof(configFieldTags) / sizeof(configFieldTags[0])) + 1;
+}
+
+template <typename T>
+static bool encodeExported(pb_ostream_t* stream, const T& message, const pb_msgdesc_t* fields, void (*keepUnexported)(T&, const T*), uint32_t tag)
+{
+    // Store the copy on the heap to avoid stack overflow
+    std::unique_ptr<T> exported(new T(message));
+    keepUnexported(*exported.get(), nullptr);
+    if (tag == 0)
+        return pb_encode(stream, fields, exported.get());
+    return pb_encode_tag(stream, PB_WT_STRING, tag) && pb_encode_submessage(stream, fields, exported.get());
+}
+
+// Only message fields can be fetched as a section
+#define ENCODE_CONFIG_STRING(fieldname, tag, submessageType) \
+    if (!section && config.has_ ## fieldname) \
+        return pb_encode_tag(stream, PB_WT_STRING, tag) && \
+            pb_encode_string(stream, reinterpret_cast<const pb_byte_t*>(config.fieldname), strnlen(config.fieldname, sizeof(config.fieldname) - 1)); \
+    return !section;
+#define ENCODE_CONFIG_MESSAGE(fieldname, tag, submessageType) \
+    if (section || config.has_ ## fieldname) \
+        return encodeExported(stream, config.fieldname, submessageType ## _fields, keepUnexported ## submessageType, section ? 0 : tag); \
+    return true;
+
+#define ENCODE_CONFIG_FIELD_0(ltype, fieldname, tag, submessageType) PREPROCESSOR_JOIN(ENCODE_CONFIG_, ltype)(fieldname, tag, submessageType)
+#define ENCODE_CONFIG_FIELD_1(ltype, fieldname, tag, submessageType) return !section;
+
+#define ENCODE_CONFIG_FIELD(parenttype, atype, htype, ltype, fieldname, tag, disallow_export) \
+    case tag: PREPROCESSOR_JOIN(ENCODE_CONFIG_FIELD_, disallow_export)(ltype, fieldname, tag, parenttype ## _ ## fieldname ## _MSGTYPE)
+
+// One exported top-level field, encoded as pb_encode() would within Config. A section is just the
+// field's message, without the tag.
+static bool encodeConfigField(pb_ostream_t* stream, const Config& config, uint32_t fieldTag, bool section)
+{
+    switch (fieldTag)
+    {
+        Config_FIELDLIST(ENCODE_CONFIG_FIELD, Config)
+    }
+    return false;
+}
+
+bool ConfigUtils::toProtobuf(const Config& config, uint32_t tag, StreamWriter& writer)
+{
+    StreamPosition position;
+    while (!writer.finished && toProtobuf(config, tag, position, writer));
+    return writer.finished || position.part == protobufPartCount(tag);
+}
+
+bool ConfigUtils::toProtobuf(const Config& config, uint32_t tag, StreamPosition& position, StreamWriter& writer)
+{
+    const uint32_t partCount = protobufPartCount(tag);
+    if (position.part >= partCount)
+        return false;
+
+    ProtobufOutput output = { writer, position.crc };
+    if (position.part < partCount - 1)
+    {
+        pb_ostream_t stream = {};
+        stream.callback = &writeProtobufOutput;
+        stream.state = &output;
+        stream.max_size = SIZE_MAX;
+        const uint32_t fieldTag = (tag != 0) ? tag : configFieldTags[position.part];
+        if (!encodeConfigField(&stream, config, fieldTag, tag != 0))
+            return writer.finished;
+    }
+    else
+    {
+        const uint32_t crc = position.crc.finalize();
+        const uint8_t trailer[4] = { static_cast<uint8_t>(crc), static_cast<uint8_t>(crc >> 8), static_cast<uint8_t>(crc >> 16), static_cast<uint8_t>(crc >> 24) };
+        writer.write(reinterpret_cast<const char*>(trailer), sizeof(trailer));
+    }
+
+    if (!writer.finished)
+    {
+        position.part++;
+        position.crc = output.crc;
+    }
+    return true;
+}
+
+bool ConfigUtils::fromProtobuf(Config& config, const Config& current, uint32_t tag, const uint8_t* data, size_t dataLen)
+{
+    if (dataLen < 4)
+        return false;
+
+    dataLen -= 4;
+    const uint32_t crc = data[dataLen] | (data[dataLen + 1] << 8) | (data[dataLen + 2] << 16) | (static_cast<uint32_t>(data[dataLen + 3]) << 24);
+    if (CRC32::calculate(data, dataLen) != crc)
+        return false;
+
+    pb_istream_t stream = pb_istream_from_buffer(data, dataLen);
+    if (tag == 0)
+    {
+        if (!pb_decode(&stream, Config_fields, &config))
+            return false;
+    }
+    else
+    {
+        // Replaces the whole section, fields it doesn't have go back to their defaults
+        pb_field_iter_t field;
+        if (!findSection(config, tag, field) || !pb_decode(&stream, field.submsg_desc, field.pData))
+            return false;
+        if (PB_HTYPE(field.type) == PB_HTYPE_OPTIONAL && field.pSize != nullptr)
+            *static_cast<bool*>(field.pSize) = true;
+    }
+
+    // a backup never has them, keep what's on the device
+    keepUnexportedConfig(config, &current);
+
+    initUnsetPropertiesWithDefaults(config);
+
+    // same as fromJSON, the data may have changed pins or things derived from pins
+    gpioMappingsMigrationCore(config);
+    migrateTurboPinToGpio(config);
+    migrateAuthenticationMethods(config);
+    migrateMacroPinsToGpio(config);
+
+    return true;
+}
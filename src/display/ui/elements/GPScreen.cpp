@@ -1,15 +1,10 @@
 #include "GPScreen.h"
 
-const bool prioritySort(GPWidget * a, GPWidget * b) {
-    return a->getPriority() > b->getPriority();
-}
-
 void GPScreen::draw() {
     getRenderer()->clearScreen();
 
     // draw the display list
     if ( displayList.size() > 0 ) {
-        std::sort(displayList.begin(), displayList.end(), prioritySort);
         for(std::vector<GPWidget*>::iterator it = displayList.begin(); it != displayList.end(); ++it) {
             (*it)->draw();
         }
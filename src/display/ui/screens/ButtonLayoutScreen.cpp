@@ -17,6 +17,7 @@ void ButtonLayoutScreen::init() {
     EventManager::getInstance().registerEventHandler(GP_EVENT_PROFILE_CHANGE, GPEVENT_CALLBACK(this->handleProfileChange(event)));
     EventManager::getInstance().registerEventHandler(GP_EVENT_USBHOST_MOUNT, GPEVENT_CALLBACK(this->handleUSB(event)));
     EventManager::getInstance().registerEventHandler(GP_EVENT_USBHOST_UNMOUNT, GPEVENT_CALLBACK(this->handleUSB(event)));
+    EventManager::getInstance().registerEventHandler(GP_EVENT_STORAGE_COMMIT, GPEVENT_CALLBACK(this->handleStorageCommit(event)));
     
     footer = "";
     historyString = "";
@@ -89,6 +90,7 @@ void ButtonLayoutScreen::shutdown() {
     EventManager::getInstance().unregisterEventHandler(GP_EVENT_PROFILE_CHANGE, GPEVENT_CALLBACK(this->handleProfileChange(event)));
     EventManager::getInstance().unregisterEventHandler(GP_EVENT_USBHOST_MOUNT, GPEVENT_CALLBACK(this->handleUSB(event)));
     EventManager::getInstance().unregisterEventHandler(GP_EVENT_USBHOST_UNMOUNT, GPEVENT_CALLBACK(this->handleUSB(event)));
+    EventManager::getInstance().unregisterEventHandler(GP_EVENT_STORAGE_COMMIT, GPEVENT_CALLBACK(this->handleStorageCommit(event)));
 }
 
 int8_t ButtonLayoutScreen::update() {
@@ -554,6 +556,22 @@ void ButtonLayoutScreen::handleUSB(GPEvent* e) {
     bannerDisplay = true;
 }
 
+void ButtonLayoutScreen::handleStorageCommit(GPEvent* e) {
+    GPStorageCommitEvent* event = (GPStorageCommitEvent*)e;
+    bannerDelayStart = getMillis();
+    prevProfileNumber = profileNumber;
+
+    // the banner times out on its own, so a dropped progress event only costs an update
+    if (event->isComplete()) {
+        bannerMessage = "   Settings Saved";
+    } else {
+        bannerMessage = "  Saving... ";
+        bannerMessage += std::to_string(event->stepsDone * 100 / event->stepsTotal);
+        bannerMessage += "%";
+    }
+    bannerDisplay = true;
+}
+
 void ButtonLayoutScreen::trim(std::string &s) {
     s.erase(s.begin(), std::find_if(s.begin(), s.end(),
             std::not1(std::ptr_fun<int, int>(std::isspace))));
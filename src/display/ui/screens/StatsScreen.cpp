@@ -3,6 +3,14 @@
 #include "pico/stdlib.h"
 #include "version.h"
 #include "drivermanager.h"
+#include "perfstats.h"
+
+#include <cstdio>
+
+// Stage rows between the title and the missed frame count
+#define STATS_STAGE_ROWS 5
+
+static const char* const phaseTags[] = { "", "pre", "prc", "pst" };
 
 void StatsScreen::init() {
     getRenderer()->clearScreen();
@@ -13,14 +21,76 @@ void StatsScreen::shutdown() {
 }
 
 void StatsScreen::drawScreen() {
-    getRenderer()->drawText(2, 0, "[GP2040-CE Stats]");
-    getRenderer()->drawText(0, 1, "Version: " GP2040VERSIONID);
-    getRenderer()->drawText(0, 2, "Build: " GP2040BUILD);
-    getRenderer()->drawText(0, 3, "Board: " GP2040_BOARDCONFIG);
-    getRenderer()->drawText(0, 4, "Type: " GP2040CONFIG);
-    getRenderer()->drawText(0, 5, "Arch: " GP2040PLATFORM);
-
-    getRenderer()->drawText(5, 7, "B2 to Return");
+    if (page == 0) {
+        getRenderer()->drawText(2, 0, "[GP2040-CE Stats]");
+        getRenderer()->drawText(0, 1, "Version: " GP2040VERSIONID);
+        getRenderer()->drawText(0, 2, "Build: " GP2040BUILD);
+        getRenderer()->drawText(0, 3, "Board: " GP2040_BOARDCONFIG);
+        getRenderer()->drawText(0, 4, "Type: " GP2040CONFIG);
+        getRenderer()->drawText(0, 5, "Arch: " GP2040PLATFORM);
+
+        getRenderer()->drawText(0, 7, "B1 Timing B2 Return");
+        return;
+    }
+
+    drawPerfPage(page - 1);
+    getRenderer()->drawText(0, 7, "B1 Next   B2 Return");
+}
+
+// Slowest stages first by p99, in microseconds
+void StatsScreen::drawPerfPage(uint8_t perfPage) {
+    PerfStats& perfStats = PerfStats::getInstance();
+    // too big for the Core1 stack
+    static PerfStageSummary summaries[PERF_MAX_STAGES];
+    static uint8_t order[PERF_MAX_STAGES];
+    uint8_t count = 0;
+
+    for (uint32_t i = 0; i < perfStats.getStageCount(); i++) {
+        if (perfStats.getStage(i, summaries[count]) && summaries[count].count > 0) {
+            order[count] = count;
+            count++;
+        }
+    }
+
+    for (uint8_t i = 1; i < count; i++) {
+        uint8_t current = order[i];
+        int8_t j = i - 1;
+        while (j >= 0 && summaries[order[j]].p99 < summaries[current].p99) {
+            order[j + 1] = order[j];
+            j--;
+        }
+        order[j + 1] = current;
+    }
+
+    perfPageCount = (count + STATS_STAGE_ROWS - 1) / STATS_STAGE_ROWS;
+    getRenderer()->drawText(0, 0, perfStats.isRecording() ? "[Timing p99 us]" : "[Last Session p99 us]");
+    if (count == 0) {
+        getRenderer()->drawText(0, 2, "No samples");
+        return;
+    }
+
+    char line[24];
+    uint32_t missedFrames = perfStats.getMissedFrames();
+    uint32_t droppedEvents = perfStats.getDroppedEvents();
+    if (missedFrames > 0 && droppedEvents > 0) {
+        snprintf(line, sizeof(line), "Missed %lu Drop %lu", (unsigned long)missedFrames, (unsigned long)droppedEvents);
+        getRenderer()->drawText(0, STATS_STAGE_ROWS + 1, line);
+    } else if (missedFrames > 0) {
+        snprintf(line, sizeof(line), "Missed Frames %lu", (unsigned long)missedFrames);
+        getRenderer()->drawText(0, STATS_STAGE_ROWS + 1, line);
+    } else if (droppedEvents > 0) {
+        snprintf(line, sizeof(line), "Dropped Events %lu", (unsigned long)droppedEvents);
+        getRenderer()->drawText(0, STATS_STAGE_ROWS + 1, line);
+    }
+
+    uint8_t first = (perfPage % perfPageCount) * STATS_STAGE_ROWS;
+    for (uint8_t row = 0; row < STATS_STAGE_ROWS && (first + row) < count; row++) {
+        const PerfStageSummary& summary = summaries[order[first + row]];
+        uint32_t p99 = summary.p99 / 1000;
+        snprintf(line, sizeof(line), "%-12.12s %-3s %4lu", summary.name, phaseTags[summary.phase & 3],
+            (unsigned long)(p99 > 9999 ? 9999 : p99));
+        getRenderer()->drawText(0, row + 1, line);
+    }
 }
 
 int8_t StatsScreen::update() {
@@ -31,6 +101,9 @@ int8_t StatsScreen::update() {
                 prevButtonState = 0;
                 return DisplayMode::CONFIG_INSTRUCTION;
             }
+            if (prevButtonState == GAMEPAD_MASK_B1) {
+                page = (page == 0 || page < perfPageCount) ? page + 1 : 0;
+            }
         }
         prevButtonState = buttonState;
     }
@@ -2,49 +2,86 @@
 #include "storagemanager.h"
 #include "enums.pb.h"
 
+#include <cassert>
+
 void EventManager::init() {
     clearEventHandlers();
 }
 
-void EventManager::registerEventHandler(GPEventType eventType, EventFunction handler) {
-    typename std::vector<EventEntry>::iterator it = std::find_if(eventList.begin(), eventList.end(), [&eventType](const EventEntry& entry) { return entry.first == eventType; });
+bool EventManager::registerEventHandler(GPEventType eventType, EventFunction handler) {
+    if (eventType >= _GPEventType_ARRAYSIZE)
+        return false;
+
+    CoreEvents& coreEvents = cores[get_core_num()];
 
-    if (it != eventList.end()) {
-        // If the event already exists, add the handler to its vector
-        it->second.push_back(handler);
+    // reuse an unregistered slot before taking a new one from the pool
+    uint8_t index;
+    if (coreEvents.freeList != EVENTMGR_NO_HANDLER) {
+        index = coreEvents.freeList;
+        coreEvents.freeList = coreEvents.handlers[index].nextFree;
+    } else if (coreEvents.handlerCount < EVENTMGR_MAX_HANDLERS) {
+        index = coreEvents.handlerCount++;
     } else {
-        // If the event does not exist, create a new entry with the handler
-        eventList.emplace_back(eventType, std::vector<EventFunction>{handler});
+        // out of handlers, raise EVENTMGR_MAX_HANDLERS
+        assert(false);
+        return false;
+    }
+
+    coreEvents.handlers[index].function = handler;
+    coreEvents.handlers[index].next = EVENTMGR_NO_HANDLER;
+
+    // append to the end of this event's chain so handlers run in registration order
+    uint8_t* link = &coreEvents.first[eventType];
+    while (*link != EVENTMGR_NO_HANDLER) {
+        link = &coreEvents.handlers[*link].next;
     }
+    *link = index;
+    return true;
 }
 
 void EventManager::unregisterEventHandler(GPEventType eventType, EventFunction handler) {
-    typename std::vector<EventEntry>::iterator it = std::find_if(eventList.begin(), eventList.end(), [&eventType](const EventEntry& entry) { return entry.first == eventType; });
-
-    // Verify we have this event in our pair list
-    if (it != eventList.end()) {
-        // Verify we have this function in our function vector
-        for(std::vector<EventFunction>::iterator funcIt = it->second.begin(); funcIt != it->second.end(); it++){
-            if(*(uint32_t *)(uint8_t *)&handler == *(uint32_t *)(uint8_t *)&(*funcIt)) {
-                it->second.erase(funcIt);
-                break;
-            }
+    if (eventType >= _GPEventType_ARRAYSIZE)
+        return;
+
+    CoreEvents& coreEvents = cores[get_core_num()];
+
+    // Verify we have this function in the event's chain
+    for (uint8_t* link = &coreEvents.first[eventType]; *link != EVENTMGR_NO_HANDLER; link = &coreEvents.handlers[*link].next) {
+        uint8_t index = *link;
+        EventHandler& entry = coreEvents.handlers[index];
+        if (*(uint32_t *)(uint8_t *)&handler == *(uint32_t *)(uint8_t *)&entry.function) {
+            // unlink it, but leave its next alone in case we're being called from inside dispatch()
+            *link = entry.next;
+            entry.function = nullptr;
+            entry.nextFree = coreEvents.freeList;
+            coreEvents.freeList = index;
+            break;
         }
     }
 }
 
-void EventManager::triggerEvent(GPEvent* event) {
-    GPEventType eventType = event->eventType();
-    for (typename std::vector<EventEntry>::const_iterator it = eventList.begin(); it != eventList.end(); ++it) {
-        if (it->first == eventType) {
-            // Call all event handlers for the specified event
-            const std::vector<EventFunction>& handlers = it->second;
-            for (typename std::vector<EventFunction>::const_iterator handler = handlers.begin(); handler != handlers.end(); ++handler) {
-                (*handler)(event);
-            }
-        }
+void EventManager::dispatch(uint8_t core, GPEventType eventType, GPEvent* event) {
+    const CoreEvents& coreEvents = cores[core];
+    for (uint8_t index = coreEvents.first[eventType]; index != EVENTMGR_NO_HANDLER; index = coreEvents.handlers[index].next) {
+        if (coreEvents.handlers[index].function)
+            coreEvents.handlers[index].function(event);
+    }
+}
+
+void EventManager::processEvents() {
+    uint8_t core = get_core_num();
+    EventQueue& queue = cores[core].queue;
+
+    while (queue.tail != queue.head) {
+        __dmb(); // don't read the slot before we've seen the other core publish it
+        uint32_t tail = queue.tail;
+        GPEvent* event = reinterpret_cast<GPEvent*>(queue.slots[tail].storage);
+        GPEventType eventType = event->eventType();
+        dispatch(core, eventType, event);
+        event->~GPEvent();
+        __dmb();
+        queue.tail = (tail + 1) & (EVENTMGR_QUEUE_SIZE - 1);
     }
-    delete event;
 }
 
 void EventManager::clearEventHandlers() {
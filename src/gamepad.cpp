@@ -36,55 +36,61 @@ void Gamepad::setup()
 	// Configure pin mapping
 	GpioMappingInfo* pinMappings = Storage::getInstance().getProfilePinMappings();
 
-	mapDpadUp       = new GamepadButtonMapping(GAMEPAD_MASK_UP);
-	mapDpadDown     = new GamepadButtonMapping(GAMEPAD_MASK_DOWN);
-	mapDpadLeft     = new GamepadButtonMapping(GAMEPAD_MASK_LEFT);
-	mapDpadRight    = new GamepadButtonMapping(GAMEPAD_MASK_RIGHT);
-	mapButtonB1     = new GamepadButtonMapping(GAMEPAD_MASK_B1);
-	mapButtonB2     = new GamepadButtonMapping(GAMEPAD_MASK_B2);
-	mapButtonB3     = new GamepadButtonMapping(GAMEPAD_MASK_B3);
-	mapButtonB4     = new GamepadButtonMapping(GAMEPAD_MASK_B4);
-	mapButtonL1     = new GamepadButtonMapping(GAMEPAD_MASK_L1);
-	mapButtonR1     = new GamepadButtonMapping(GAMEPAD_MASK_R1);
-	mapButtonL2     = new GamepadButtonMapping(GAMEPAD_MASK_L2);
-	mapButtonR2     = new GamepadButtonMapping(GAMEPAD_MASK_R2);
-	mapButtonS1     = new GamepadButtonMapping(GAMEPAD_MASK_S1);
-	mapButtonS2     = new GamepadButtonMapping(GAMEPAD_MASK_S2);
-	mapButtonL3     = new GamepadButtonMapping(GAMEPAD_MASK_L3);
-	mapButtonR3     = new GamepadButtonMapping(GAMEPAD_MASK_R3);
-	mapButtonA1     = new GamepadButtonMapping(GAMEPAD_MASK_A1);
-	mapButtonA2     = new GamepadButtonMapping(GAMEPAD_MASK_A2);
-	mapButtonA3     = new GamepadButtonMapping(GAMEPAD_MASK_A3);
-	mapButtonA4     = new GamepadButtonMapping(GAMEPAD_MASK_A4);
-	mapButtonE1     = new GamepadButtonMapping(GAMEPAD_MASK_E1);
-	mapButtonE2     = new GamepadButtonMapping(GAMEPAD_MASK_E2);
-	mapButtonE3     = new GamepadButtonMapping(GAMEPAD_MASK_E3);
-	mapButtonE4     = new GamepadButtonMapping(GAMEPAD_MASK_E4);
-	mapButtonE5     = new GamepadButtonMapping(GAMEPAD_MASK_E5);
-	mapButtonE6     = new GamepadButtonMapping(GAMEPAD_MASK_E6);
-	mapButtonE7     = new GamepadButtonMapping(GAMEPAD_MASK_E7);
-	mapButtonE8     = new GamepadButtonMapping(GAMEPAD_MASK_E8);
-	mapButtonE9     = new GamepadButtonMapping(GAMEPAD_MASK_E9);
-	mapButtonE10    = new GamepadButtonMapping(GAMEPAD_MASK_E10);
-	mapButtonE11    = new GamepadButtonMapping(GAMEPAD_MASK_E11);
-	mapButtonE12    = new GamepadButtonMapping(GAMEPAD_MASK_E12);
-	mapButtonFn     = new GamepadButtonMapping(AUX_MASK_FUNCTION);
-	mapButtonDP     = new GamepadButtonMapping(SUSTAIN_DP_MODE_DP);
-	mapButtonLS     = new GamepadButtonMapping(SUSTAIN_DP_MODE_LS);
-	mapButtonRS     = new GamepadButtonMapping(SUSTAIN_DP_MODE_RS);
-	mapDigitalUp    = new GamepadButtonMapping(GAMEPAD_MASK_UP);
-	mapDigitalDown  = new GamepadButtonMapping(GAMEPAD_MASK_DOWN);
-	mapDigitalLeft  = new GamepadButtonMapping(GAMEPAD_MASK_LEFT);
-	mapDigitalRight = new GamepadButtonMapping(GAMEPAD_MASK_RIGHT);
-	mapAnalogLSXNeg = new GamepadButtonMapping(ANALOG_DIRECTION_LS_X_NEG);
-	mapAnalogLSXPos = new GamepadButtonMapping(ANALOG_DIRECTION_LS_X_POS);
-	mapAnalogLSYNeg = new GamepadButtonMapping(ANALOG_DIRECTION_LS_Y_NEG);
-	mapAnalogLSYPos = new GamepadButtonMapping(ANALOG_DIRECTION_LS_Y_POS);
-	mapAnalogRSXNeg = new GamepadButtonMapping(ANALOG_DIRECTION_RS_X_NEG);
-	mapAnalogRSXPos = new GamepadButtonMapping(ANALOG_DIRECTION_RS_X_POS);
-	mapAnalogRSYNeg = new GamepadButtonMapping(ANALOG_DIRECTION_RS_Y_NEG);
-	mapAnalogRSYPos = new GamepadButtonMapping(ANALOG_DIRECTION_RS_Y_POS);
-	map48WayMode    = new GamepadButtonMapping(SUSTAIN_4_8_WAY_MODE);
+	// the arena is only ever allocated once, reinit() hands out the same slots again
+	if (mappingArena == nullptr) {
+		mappingArena = new GamepadMappingArena();
+	}
+	mappingArena->count = 0;
+
+	mapDpadUp       = addMapping(GAMEPAD_MASK_UP);
+	mapDpadDown     = addMapping(GAMEPAD_MASK_DOWN);
+	mapDpadLeft     = addMapping(GAMEPAD_MASK_LEFT);
+	mapDpadRight    = addMapping(GAMEPAD_MASK_RIGHT);
+	mapButtonB1     = addMapping(GAMEPAD_MASK_B1);
+	mapButtonB2     = addMapping(GAMEPAD_MASK_B2);
+	mapButtonB3     = addMapping(GAMEPAD_MASK_B3);
+	mapButtonB4     = addMapping(GAMEPAD_MASK_B4);
+	mapButtonL1     = addMapping(GAMEPAD_MASK_L1);
+	mapButtonR1     = addMapping(GAMEPAD_MASK_R1);
+	mapButtonL2     = addMapping(GAMEPAD_MASK_L2);
+	mapButtonR2     = addMapping(GAMEPAD_MASK_R2);
+	mapButtonS1     = addMapping(GAMEPAD_MASK_S1);
+	mapButtonS2     = addMapping(GAMEPAD_MASK_S2);
+	mapButtonL3     = addMapping(GAMEPAD_MASK_L3);
+	mapButtonR3     = addMapping(GAMEPAD_MASK_R3);
+	mapButtonA1     = addMapping(GAMEPAD_MASK_A1);
+	mapButtonA2     = addMapping(GAMEPAD_MASK_A2);
+	mapButtonA3     = addMapping(GAMEPAD_MASK_A3);
+	mapButtonA4     = addMapping(GAMEPAD_MASK_A4);
+	mapButtonE1     = addMapping(GAMEPAD_MASK_E1);
+	mapButtonE2     = addMapping(GAMEPAD_MASK_E2);
+	mapButtonE3     = addMapping(GAMEPAD_MASK_E3);
+	mapButtonE4     = addMapping(GAMEPAD_MASK_E4);
+	mapButtonE5     = addMapping(GAMEPAD_MASK_E5);
+	mapButtonE6     = addMapping(GAMEPAD_MASK_E6);
+	mapButtonE7     = addMapping(GAMEPAD_MASK_E7);
+	mapButtonE8     = addMapping(GAMEPAD_MASK_E8);
+	mapButtonE9     = addMapping(GAMEPAD_MASK_E9);
+	mapButtonE10    = addMapping(GAMEPAD_MASK_E10);
+	mapButtonE11    = addMapping(GAMEPAD_MASK_E11);
+	mapButtonE12    = addMapping(GAMEPAD_MASK_E12);
+	mapButtonFn     = addMapping(AUX_MASK_FUNCTION);
+	mapButtonDP     = addMapping(SUSTAIN_DP_MODE_DP);
+	mapButtonLS     = addMapping(SUSTAIN_DP_MODE_LS);
+	mapButtonRS     = addMapping(SUSTAIN_DP_MODE_RS);
+	mapDigitalUp    = addMapping(GAMEPAD_MASK_UP);
+	mapDigitalDown  = addMapping(GAMEPAD_MASK_DOWN);
+	mapDigitalLeft  = addMapping(GAMEPAD_MASK_LEFT);
+	mapDigitalRight = addMapping(GAMEPAD_MASK_RIGHT);
+	mapAnalogLSXNeg = addMapping(ANALOG_DIRECTION_LS_X_NEG);
+	mapAnalogLSXPos = addMapping(ANALOG_DIRECTION_LS_X_POS);
+	mapAnalogLSYNeg = addMapping(ANALOG_DIRECTION_LS_Y_NEG);
+	mapAnalogLSYPos = addMapping(ANALOG_DIRECTION_LS_Y_POS);
+	mapAnalogRSXNeg = addMapping(ANALOG_DIRECTION_RS_X_NEG);
+	mapAnalogRSXPos = addMapping(ANALOG_DIRECTION_RS_X_POS);
+	mapAnalogRSYNeg = addMapping(ANALOG_DIRECTION_RS_Y_NEG);
+	mapAnalogRSYPos = addMapping(ANALOG_DIRECTION_RS_Y_POS);
+	map48WayMode    = addMapping(SUSTAIN_4_8_WAY_MODE);
 
 	const auto assignCustomMappingToMaps = [&](GpioMappingInfo mapInfo, Pin_t pin) -> void {
 		if (mapDpadUp->buttonMask & mapInfo.customDpadMask)	mapDpadUp->pinMask |= 1 << pin;
@@ -168,6 +174,8 @@ void Gamepad::setup()
 		}
 	}
 
+	buildInputLUT();
+
 	// Define our hotkey array
 	hotkeys[0] = hotkeyOptions.hotkey01;
 	hotkeys[1] = hotkeyOptions.hotkey02;
@@ -188,64 +196,110 @@ void Gamepad::setup()
 }
 
 /**
- * @brief Undo setup().
+ * @brief Reload pin mappings after a profile change.
  */
 void Gamepad::reinit()
 {
-	delete mapDpadUp;
-	delete mapDpadDown;
-	delete mapDpadLeft;
-	delete mapDpadRight;
-	delete mapButtonB1;
-	delete mapButtonB2;
-	delete mapButtonB3;
-	delete mapButtonB4;
-	delete mapButtonL1;
-	delete mapButtonR1;
-	delete mapButtonL2;
-	delete mapButtonR2;
-	delete mapButtonS1;
-	delete mapButtonS2;
-	delete mapButtonL3;
-	delete mapButtonR3;
-	delete mapButtonA1;
-	delete mapButtonA2;
-	delete mapButtonA3;
-	delete mapButtonA4;
-	delete mapButtonE1;
-	delete mapButtonE2;
-	delete mapButtonE3;
-	delete mapButtonE4;
-	delete mapButtonE5;
-	delete mapButtonE6;
-	delete mapButtonE7;
-	delete mapButtonE8;
-	delete mapButtonE9;
-	delete mapButtonE10;
-	delete mapButtonE11;
-	delete mapButtonE12;
-	delete mapButtonFn;
-	delete mapButtonDP;
-	delete mapButtonLS;
-	delete mapButtonRS;
-	delete mapDigitalUp;
-	delete mapDigitalDown;
-	delete mapDigitalLeft;
-	delete mapDigitalRight;
-	delete mapAnalogLSXNeg;
-	delete mapAnalogLSXPos;
-	delete mapAnalogLSYNeg;
-	delete mapAnalogLSYPos;
-	delete mapAnalogRSXNeg;
-	delete mapAnalogRSXPos;
-	delete mapAnalogRSYNeg;
-	delete mapAnalogRSYPos;
-	delete map48WayMode;
-
 	// reinitialize pin mappings
 	this->setup();
 }
 
+/**
+ * @brief Hand out the next mapping slot in the arena, reset to the given button mask.
+ */
+GamepadButtonMapping * Gamepad::addMapping(Mask_t buttonMask)
+{
+	GamepadButtonMapping * mapping = &mappingArena->mappings[mappingArena->count++];
+	*mapping = GamepadButtonMapping(buttonMask);
+	return mapping;
+}
+
+/**
+ * @brief Precompute, for every nibble of debouncedGpio, the state each of its 16 values produces.
+ *
+ * Must be rerun whenever a pinMask changes. Priority between conflicting mappings (DP over LS over RS,
+ * negative over positive analog directions) is still resolved in read().
+ */
+void Gamepad::buildInputLUT()
+{
+	const struct {
+		GamepadButtonMapping * mapping;
+		uint32_t buttons;
+		uint16_t aux;
+		uint8_t dpad;
+		uint8_t analog;
+		uint8_t modes;
+	} sources[] = {
+		{ mapDpadUp,       0, 0, GAMEPAD_MASK_UP,           0, 0 },
+		{ mapDpadDown,     0, 0, GAMEPAD_MASK_DOWN,         0, 0 },
+		{ mapDpadLeft,     0, 0, GAMEPAD_MASK_LEFT,         0, 0 },
+		{ mapDpadRight,    0, 0, GAMEPAD_MASK_RIGHT,        0, 0 },
+		{ mapDigitalUp,    0, 0, GAMEPAD_MASK_UP << 4,      0, 0 },
+		{ mapDigitalDown,  0, 0, GAMEPAD_MASK_DOWN << 4,    0, 0 },
+		{ mapDigitalLeft,  0, 0, GAMEPAD_MASK_LEFT << 4,    0, 0 },
+		{ mapDigitalRight, 0, 0, GAMEPAD_MASK_RIGHT << 4,   0, 0 },
+		{ mapButtonB1,     GAMEPAD_MASK_B1,  0, 0, 0, 0 },
+		{ mapButtonB2,     GAMEPAD_MASK_B2,  0, 0, 0, 0 },
+		{ mapButtonB3,     GAMEPAD_MASK_B3,  0, 0, 0, 0 },
+		{ mapButtonB4,     GAMEPAD_MASK_B4,  0, 0, 0, 0 },
+		{ mapButtonL1,     GAMEPAD_MASK_L1,  0, 0, 0, 0 },
+		{ mapButtonR1,     GAMEPAD_MASK_R1,  0, 0, 0, 0 },
+		{ mapButtonL2,     GAMEPAD_MASK_L2,  0, 0, 0, 0 },
+		{ mapButtonR2,     GAMEPAD_MASK_R2,  0, 0, 0, 0 },
+		{ mapButtonS1,     GAMEPAD_MASK_S1,  0, 0, 0, 0 },
+		{ mapButtonS2,     GAMEPAD_MASK_S2,  0, 0, 0, 0 },
+		{ mapButtonL3,     GAMEPAD_MASK_L3,  0, 0, 0, 0 },
+		{ mapButtonR3,     GAMEPAD_MASK_R3,  0, 0, 0, 0 },
+		{ mapButtonA1,     GAMEPAD_MASK_A1,  0, 0, 0, 0 },
+		{ mapButtonA2,     GAMEPAD_MASK_A2,  0, 0, 0, 0 },
+		{ mapButtonA3,     GAMEPAD_MASK_A3,  0, 0, 0, 0 },
+		{ mapButtonA4,     GAMEPAD_MASK_A4,  0, 0, 0, 0 },
+		{ mapButtonE1,     GAMEPAD_MASK_E1,  0, 0, 0, 0 },
+		{ mapButtonE2,     GAMEPAD_MASK_E2,  0, 0, 0, 0 },
+		{ mapButtonE3,     GAMEPAD_MASK_E3,  0, 0, 0, 0 },
+		{ mapButtonE4,     GAMEPAD_MASK_E4,  0, 0, 0, 0 },
+		{ mapButtonE5,     GAMEPAD_MASK_E5,  0, 0, 0, 0 },
+		{ mapButtonE6,     GAMEPAD_MASK_E6,  0, 0, 0, 0 },
+		{ mapButtonE7,     GAMEPAD_MASK_E7,  0, 0, 0, 0 },
+		{ mapButtonE8,     GAMEPAD_MASK_E8,  0, 0, 0, 0 },
+		{ mapButtonE9,     GAMEPAD_MASK_E9,  0, 0, 0, 0 },
+		{ mapButtonE10,    GAMEPAD_MASK_E10, 0, 0, 0, 0 },
+		{ mapButtonE11,    GAMEPAD_MASK_E11, 0, 0, 0, 0 },
+		{ mapButtonE12,    GAMEPAD_MASK_E12, 0, 0, 0, 0 },
+		{ mapButtonFn,     0, AUX_MASK_FUNCTION, 0, 0, 0 },
+		{ mapButtonDP,     0, 0, 0, 0, GAMEPAD_LUT_MODE_DP },
+		{ mapButtonLS,     0, 0, 0, 0, GAMEPAD_LUT_MODE_LS },
+		{ mapButtonRS,     0, 0, 0, 0, GAMEPAD_LUT_MODE_RS },
+		{ map48WayMode,    0, 0, 0, 0, GAMEPAD_LUT_MODE_48WAY },
+		{ mapAnalogLSXNeg, 0, 0, 0, GAMEPAD_LUT_LS_X_NEG, 0 },
+		{ mapAnalogLSXPos, 0, 0, 0, GAMEPAD_LUT_LS_X_POS, 0 },
+		{ mapAnalogLSYNeg, 0, 0, 0, GAMEPAD_LUT_LS_Y_NEG, 0 },
+		{ mapAnalogLSYPos, 0, 0, 0, GAMEPAD_LUT_LS_Y_POS, 0 },
+		{ mapAnalogRSXNeg, 0, 0, 0, GAMEPAD_LUT_RS_X_NEG, 0 },
+		{ mapAnalogRSXPos, 0, 0, 0, GAMEPAD_LUT_RS_X_POS, 0 },
+		{ mapAnalogRSYNeg, 0, 0, 0, GAMEPAD_LUT_RS_Y_NEG, 0 },
+		{ mapAnalogRSYPos, 0, 0, 0, GAMEPAD_LUT_RS_Y_POS, 0 },
+	};
+
+	for (uint8_t nibble = 0; nibble < GAMEPAD_LUT_NIBBLES; nibble++) {
+		for (uint8_t value = 0; value < 16; value++) {
+			GamepadInputLUTEntry & entry = mappingArena->lut[nibble][value];
+			entry = {};
+
+			Mask_t pins = (Mask_t)value << (nibble * 4);
+			for (const auto & source : sources) {
+				if (pins & source.mapping->pinMask) {
+					entry.buttons |= source.buttons;
+					entry.aux |= source.aux;
+					entry.dpad |= source.dpad;
+					entry.analog |= source.analog;
+					entry.modes |= source.modes;
+				}
+			}
+		}
+	}
+}
+
 void Gamepad::process()
 {
 	// NOTE: Inverted X/Y-axis must run before SOCD and Dpad processing
@@ -325,84 +379,59 @@ void Gamepad::read()
 		joystickMid = DriverManager::getInstance().getDriver()->GetJoystickMidValue();
 	}
 
-	state.aux = 0
-		| (values & mapButtonFn->pinMask)   ? mapButtonFn->buttonMask : 0;
-
-	state.dpad = 0
-		| ((values & mapDpadUp->pinMask)       ? mapDpadUp->buttonMask              : 0)
-		| ((values & mapDpadDown->pinMask)     ? mapDpadDown->buttonMask            : 0)
-		| ((values & mapDpadLeft->pinMask)     ? mapDpadLeft->buttonMask            : 0)
-		| ((values & mapDpadRight->pinMask)    ? mapDpadRight->buttonMask           : 0)
-		| ((values & mapDigitalUp->pinMask)    ? (mapDigitalUp->buttonMask << 4)    : 0)
-		| ((values & mapDigitalDown->pinMask)  ? (mapDigitalDown->buttonMask << 4)  : 0)
-		| ((values & mapDigitalLeft->pinMask)  ? (mapDigitalLeft->buttonMask << 4)  : 0)
-		| ((values & mapDigitalRight->pinMask) ? (mapDigitalRight->buttonMask << 4) : 0)
-	;
-
-	state.buttons = 0
-		| ((values & mapButtonB1->pinMask)  ? mapButtonB1->buttonMask  : 0)
-		| ((values & mapButtonB2->pinMask)  ? mapButtonB2->buttonMask  : 0)
-		| ((values & mapButtonB3->pinMask)  ? mapButtonB3->buttonMask  : 0)
-		| ((values & mapButtonB4->pinMask)  ? mapButtonB4->buttonMask  : 0)
-		| ((values & mapButtonL1->pinMask)  ? mapButtonL1->buttonMask  : 0)
-		| ((values & mapButtonR1->pinMask)  ? mapButtonR1->buttonMask  : 0)
-		| ((values & mapButtonL2->pinMask)  ? mapButtonL2->buttonMask  : 0)
-		| ((values & mapButtonR2->pinMask)  ? mapButtonR2->buttonMask  : 0)
-		| ((values & mapButtonS1->pinMask)  ? mapButtonS1->buttonMask  : 0)
-		| ((values & mapButtonS2->pinMask)  ? mapButtonS2->buttonMask  : 0)
-		| ((values & mapButtonL3->pinMask)  ? mapButtonL3->buttonMask  : 0)
-		| ((values & mapButtonR3->pinMask)  ? mapButtonR3->buttonMask  : 0)
-		| ((values & mapButtonA1->pinMask)  ? mapButtonA1->buttonMask  : 0)
-		| ((values & mapButtonA2->pinMask)  ? mapButtonA2->buttonMask  : 0)
-		| ((values & mapButtonA3->pinMask)  ? mapButtonA3->buttonMask  : 0)
-		| ((values & mapButtonA4->pinMask)  ? mapButtonA4->buttonMask  : 0)
-		| ((values & mapButtonE1->pinMask)  ? mapButtonE1->buttonMask  : 0)
-		| ((values & mapButtonE2->pinMask)  ? mapButtonE2->buttonMask  : 0)
-		| ((values & mapButtonE3->pinMask)  ? mapButtonE3->buttonMask  : 0)
-		| ((values & mapButtonE4->pinMask)  ? mapButtonE4->buttonMask  : 0)
-		| ((values & mapButtonE5->pinMask)  ? mapButtonE5->buttonMask  : 0)
-		| ((values & mapButtonE6->pinMask)  ? mapButtonE6->buttonMask  : 0)
-		| ((values & mapButtonE7->pinMask)  ? mapButtonE7->buttonMask  : 0)
-		| ((values & mapButtonE8->pinMask)  ? mapButtonE8->buttonMask  : 0)
-		| ((values & mapButtonE9->pinMask)  ? mapButtonE9->buttonMask  : 0)
-		| ((values & mapButtonE10->pinMask) ? mapButtonE10->buttonMask : 0)
-		| ((values & mapButtonE11->pinMask) ? mapButtonE11->buttonMask : 0)
-		| ((values & mapButtonE12->pinMask) ? mapButtonE12->buttonMask : 0)
-	;
+	// translate the GPIO bank one nibble at a time, see buildInputLUT()
+	uint32_t buttons = 0;
+	uint16_t aux = 0;
+	uint8_t dpad = 0;
+	uint8_t analog = 0;
+	uint8_t modes = 0;
+	const GamepadInputLUTEntry (*lut)[16] = mappingArena->lut;
+	for (uint8_t nibble = 0; nibble < GAMEPAD_LUT_NIBBLES; nibble++, values >>= 4) {
+		const GamepadInputLUTEntry & entry = lut[nibble][values & 0x0F];
+		buttons |= entry.buttons;
+		aux     |= entry.aux;
+		dpad    |= entry.dpad;
+		analog  |= entry.analog;
+		modes   |= entry.modes;
+	}
+
+	state.aux = aux;
+	state.dpad = dpad;
+	state.buttons = buttons;
 
 	// set the effective dpad mode based on settings + overrides
-	if (values & mapButtonDP->pinMask)	activeDpadMode = DpadMode::DPAD_MODE_DIGITAL;
-	else if (values & mapButtonLS->pinMask)	activeDpadMode = DpadMode::DPAD_MODE_LEFT_ANALOG;
-	else if (values & mapButtonRS->pinMask)	activeDpadMode = DpadMode::DPAD_MODE_RIGHT_ANALOG;
+	if (modes & GAMEPAD_LUT_MODE_DP)	activeDpadMode = DpadMode::DPAD_MODE_DIGITAL;
+	else if (modes & GAMEPAD_LUT_MODE_LS)	activeDpadMode = DpadMode::DPAD_MODE_LEFT_ANALOG;
+	else if (modes & GAMEPAD_LUT_MODE_RS)	activeDpadMode = DpadMode::DPAD_MODE_RIGHT_ANALOG;
 	else					activeDpadMode = options.dpadMode;
 
-	map48WayModeToggle = (values & map48WayMode->pinMask);
+	map48WayModeToggle = (modes & GAMEPAD_LUT_MODE_48WAY);
 
-	if (values & mapAnalogLSXNeg->pinMask) {
+	if (analog & GAMEPAD_LUT_LS_X_NEG) {
 		state.lx = GAMEPAD_JOYSTICK_MIN;
-	} else if (values & mapAnalogLSXPos->pinMask) {
+	} else if (analog & GAMEPAD_LUT_LS_X_POS) {
 		state.lx = GAMEPAD_JOYSTICK_MAX;
 	} else {
 		state.lx = joystickMid;
 	}
-	if (values & mapAnalogLSYNeg->pinMask) {
+	if (analog & GAMEPAD_LUT_LS_Y_NEG) {
 		state.ly = GAMEPAD_JOYSTICK_MIN;
-	} else if (values & mapAnalogLSYPos->pinMask) {
+	} else if (analog & GAMEPAD_LUT_LS_Y_POS) {
 		state.ly = GAMEPAD_JOYSTICK_MAX;
 	} else {
 		state.ly = joystickMid;
 	}
 
-	if (values & mapAnalogRSXNeg->pinMask) {
+	if (analog & GAMEPAD_LUT_RS_X_NEG) {
 		state.rx = GAMEPAD_JOYSTICK_MIN;
-	} else if (values & mapAnalogRSXPos->pinMask) {
+	} else if (analog & GAMEPAD_LUT_RS_X_POS) {
 		state.rx = GAMEPAD_JOYSTICK_MAX;
 	} else {
 		state.rx = joystickMid;
 	}
-	if (values & mapAnalogRSYNeg->pinMask) {
+	if (analog & GAMEPAD_LUT_RS_Y_NEG) {
 		state.ry = GAMEPAD_JOYSTICK_MIN;
-	} else if (values & mapAnalogRSYPos->pinMask) {
+	} else if (analog & GAMEPAD_LUT_RS_Y_POS) {
 		state.ry = GAMEPAD_JOYSTICK_MAX;
 	} else {
 		state.ry = joystickMid;
@@ -674,37 +703,37 @@ void Gamepad::processHotkeyAction(GamepadHotkey action) {
 			break;
 		case HOTKEY_MENU_NAV_UP:
 			if (action != lastAction) {
-                EventManager::getInstance().triggerEvent(new GPMenuNavigateEvent(GpioAction::MENU_NAVIGATION_UP));
+                EventManager::getInstance().triggerEvent(GPMenuNavigateEvent(GpioAction::MENU_NAVIGATION_UP));
             }
 			break;
 		case HOTKEY_MENU_NAV_DOWN:
 			if (action != lastAction) {
-                EventManager::getInstance().triggerEvent(new GPMenuNavigateEvent(GpioAction::MENU_NAVIGATION_DOWN));
+                EventManager::getInstance().triggerEvent(GPMenuNavigateEvent(GpioAction::MENU_NAVIGATION_DOWN));
             }
 			break;
 		case HOTKEY_MENU_NAV_LEFT:
 			if (action != lastAction) {
-                EventManager::getInstance().triggerEvent(new GPMenuNavigateEvent(GpioAction::MENU_NAVIGATION_LEFT));
+                EventManager::getInstance().triggerEvent(GPMenuNavigateEvent(GpioAction::MENU_NAVIGATION_LEFT));
             }
 			break;
 		case HOTKEY_MENU_NAV_RIGHT:
 			if (action != lastAction) {
-                EventManager::getInstance().triggerEvent(new GPMenuNavigateEvent(GpioAction::MENU_NAVIGATION_RIGHT));
+                EventManager::getInstance().triggerEvent(GPMenuNavigateEvent(GpioAction::MENU_NAVIGATION_RIGHT));
             }
 			break;
 		case HOTKEY_MENU_NAV_SELECT:
 			if (action != lastAction) {
-                EventManager::getInstance().triggerEvent(new GPMenuNavigateEvent(GpioAction::MENU_NAVIGATION_SELECT));
+                EventManager::getInstance().triggerEvent(GPMenuNavigateEvent(GpioAction::MENU_NAVIGATION_SELECT));
             }
 			break;
 		case HOTKEY_MENU_NAV_BACK:
 			if (action != lastAction) {
-                EventManager::getInstance().triggerEvent(new GPMenuNavigateEvent(GpioAction::MENU_NAVIGATION_BACK));
+                EventManager::getInstance().triggerEvent(GPMenuNavigateEvent(GpioAction::MENU_NAVIGATION_BACK));
             }
 			break;
 		case HOTKEY_MENU_NAV_TOGGLE:
 			if (action != lastAction) {
-				EventManager::getInstance().triggerEvent(new GPMenuNavigateEvent(GpioAction::MENU_NAVIGATION_TOGGLE));
+				EventManager::getInstance().triggerEvent(GPMenuNavigateEvent(GpioAction::MENU_NAVIGATION_TOGGLE));
 			}
 			break;
 		default: // Unknown action
@@ -713,7 +742,7 @@ void Gamepad::processHotkeyAction(GamepadHotkey action) {
 
 	// only save if requested
 	if (reqSave) {
-		EventManager::getInstance().triggerEvent(new GPStorageSaveEvent(true));
+		EventManager::getInstance().triggerEvent(GPStorageSaveEvent(true));
 	}
 
 	lastAction = action;
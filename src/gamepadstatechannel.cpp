@@ -0,0 +1,35 @@
+#include "gamepadstatechannel.h"
+
+#include <string.h>
+
+#include "hardware/sync.h"
+
+void GamepadStateChannel::publish(const GamepadState& newState, const GamepadAuxState& newAuxState) {
+    sequence = sequence + 1; // odd, Core1 will retry anything it reads now
+    __dmb();
+    memcpy(&state, &newState, sizeof(GamepadState));
+    memcpy(&auxState, &newAuxState, sizeof(GamepadAuxState));
+    __dmb();
+    sequence = sequence + 1;
+
+    // wake Core1 if it's waiting in GP2040Aux::run()
+    __sev();
+}
+
+bool GamepadStateChannel::read(GamepadState& outState, GamepadAuxState& outAuxState, uint32_t& lastSequence) {
+    uint32_t start;
+    do {
+        start = sequence;
+        if (start == lastSequence)
+            return false;
+        if (start & 1)
+            continue; // mid-publish
+        __dmb();
+        memcpy(&outState, &state, sizeof(GamepadState));
+        memcpy(&outAuxState, &auxState, sizeof(GamepadAuxState));
+        __dmb();
+    } while ((start & 1) || start != sequence);
+
+    lastSequence = start;
+    return true;
+}
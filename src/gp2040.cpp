@@ -10,6 +10,11 @@
 #include "addonmanager.h"
 #include "types.h"
 #include "usbhostmanager.h"
+#include "gpioedgecapture.h"
+#include "gamepadstatechannel.h"
+#include "reportscheduler.h"
+#include "perfstats.h"
+#include "FlashPROM.h"
 
 // Inputs for Core0
 #include "addons/analog.h"
@@ -50,6 +55,18 @@ static const uint32_t REBOOT_HOTKEY_HOLD_TIME_MS = 4000;
 const static uint32_t rebootDelayMs = 500;
 static absolute_time_t rebootDelayTimeout = nil_time;
 
+// A page program takes around 0.4-0.8 ms, only start one with at least this long before the next report
+const static uint32_t flashProgramUs = 800;
+// Longest a step waits for a good moment: a report going out (not frame-synced) or a frame with room
+const static uint32_t flashStepIdleUs = 1000;
+const static uint32_t flashStepSyncedIdleUs = 20000;
+// A sector erase stalls both cores and USB for 45-400 ms wherever it lands, so it waits until the inputs
+// have been left alone for a while, but not forever
+const static uint32_t flashEraseIdleMs = 250;
+const static uint32_t flashEraseMaxWaitMs = 2000;
+static absolute_time_t lastFlashStep = nil_time;
+static absolute_time_t lastInputChange = nil_time;
+
 void GP2040::setup() {
 	Storage::getInstance().init();
 
@@ -59,6 +76,9 @@ void GP2040::setup() {
 		set_sys_clock_khz(120000, true); // Set Clock to 120MHz to avoid potential USB timing issues
 	}
 
+	// Stage timing is in system clock cycles and add-ons register their stages as they load
+	PerfStats::getInstance().init();
+
 	// I2C & SPI rely on the system clock
 	PeripheralManager::getInstance().initSPI();
 	PeripheralManager::getInstance().initI2C();
@@ -206,12 +226,21 @@ void GP2040::initializeStandardGpio() {
 			buttonGpios |= 1 << pin;    // mark this pin as mattering for GPIO debouncing
 		}
 	}
+
+	// timestamp button edges from the GPIO IRQ instead of sampling once per loop, if configured
+	const GamepadOptions& gamepadOptions = Storage::getInstance().getGamepadOptions();
+	if (gamepadOptions.debounceMode == DEBOUNCE_MODE_EDGE_CAPTURE && gamepadOptions.debounceDelay > 0) {
+		eagerGpios = gamepadOptions.debounceEagerPins & buttonGpios;
+		GPIOEdgeCapture::getInstance().start(buttonGpios);
+	}
 }
 
 /**
  * @brief Deinitialize standard input button GPIOs that are present in the currently loaded profile.
  */
 void GP2040::deinitializeStandardGpio() {
+	GPIOEdgeCapture::getInstance().stop();
+
 	GpioMappingInfo* pinMappings = Storage::getInstance().getProfilePinMappings();
 	for (Pin_t pin = 0; pin < (Pin_t)NUM_BANK0_GPIOS; pin++)
 	{
@@ -234,6 +263,11 @@ void GP2040::deinitializeStandardGpio() {
  * instead, if you don't want debounced data.
  */
 void GP2040::debounceGpioGetAll() {
+	if (GPIOEdgeCapture::getInstance().isRunning()) {
+		debounceGpioEdges();
+		return;
+	}
+
 	Mask_t raw_gpio = ~gpio_get_all();
 	Gamepad* gamepad = Storage::getInstance().GetGamepad();
 	// return if state isn't different than the actual
@@ -261,12 +295,69 @@ void GP2040::debounceGpioGetAll() {
 	}
 }
 
+/**
+ * @brief Edge capture variant of debounceGpioGetAll, driven by the timestamps GPIOEdgeCapture records.
+ *
+ * Pins in eagerGpios change state on the first edge that lands outside the debounce window of their
+ * previous change (press-on-first-edge). Every other pin (deferred) only changes once it has been
+ * stable for the debounce delay since its last edge. Both are measured in microseconds from when the
+ * edge actually happened, so a slow loop pass doesn't add to the debounce time.
+ */
+void GP2040::debounceGpioEdges() {
+	GPIOEdgeCapture& capture = GPIOEdgeCapture::getInstance();
+	Gamepad* gamepad = Storage::getInstance().GetGamepad();
+	uint32_t debounceDelay = Storage::getInstance().getGamepadOptions().debounceDelay * 1000;
+
+	GPIOEdgeEvent event;
+	while (capture.pop(event)) {
+		Mask_t pin_mask = 1 << event.pin;
+		gpioEdgeTime[event.pin] = event.timestamp;
+
+		if ((eagerGpios & pin_mask) && (((gamepad->debouncedGpio & pin_mask) != 0) != event.pressed) &&
+				((event.timestamp - gpioDebounceTime[event.pin]) >= debounceDelay)) {
+			gamepad->debouncedGpio ^= pin_mask;
+			gpioDebounceTime[event.pin] = event.timestamp;
+		}
+	}
+
+	uint32_t now = time_us_32();
+
+	// we lost track of some edges, make every pin sit out a full debounce window
+	if (capture.takeOverflow()) {
+		for (Pin_t pin = 0; pin < (Pin_t)NUM_BANK0_GPIOS; pin++) {
+			gpioEdgeTime[pin] = now;
+		}
+	}
+
+	// settle any pin that has been stable for the debounce delay but still disagrees with its debounced state
+	Mask_t changed = (~gpio_get_all() ^ gamepad->debouncedGpio) & buttonGpios;
+	while (changed) {
+		Pin_t pin = __builtin_ctz(changed);
+		changed &= changed - 1;
+
+		if ((now - gpioEdgeTime[pin]) >= debounceDelay) {
+			gamepad->debouncedGpio ^= (1 << pin);
+			gpioDebounceTime[pin] = gpioEdgeTime[pin];
+		}
+	}
+}
+
 void GP2040::run() {
-	bool configMode = DriverManager::getInstance().isConfigMode();
-	GPDriver * inputDriver = DriverManager::getInstance().getDriver();
-	Gamepad * gamepad = Storage::getInstance().GetGamepad();
-	Gamepad * processedGamepad = Storage::getInstance().GetProcessedGamepad();
-    GamepadState prevState;
+	this->start();
+
+	while (1) { // LOOP
+		this->process();
+	}
+}
+
+/**
+ * @brief Bring up USB and the report scheduler ahead of the Core0 loop.
+ *
+ * Split out of run() so the host bench in bench/ can start the pipeline and then step process() itself.
+ */
+void GP2040::start() {
+	configMode = DriverManager::getInstance().isConfigMode();
+	inputDriver = DriverManager::getInstance().getDriver();
 
     // Start the TinyUSB Device functionality
     tud_init(TUD_OPT_RHPORT);
@@ -278,57 +369,123 @@ void GP2040::run() {
 		rndis_init();
 	}
 
-	while (1) { // LOOP
-		this->getReinitGamepad(gamepad);
+	// Persist whatever loading the config migrated, now that USB is already on its way up
+	if (Storage::getInstance().takeSaveAfterLoad()) {
+		saveRequested = true;
+		forceSave = true;
+	}
 
-		memcpy(&prevState, &gamepad->state, sizeof(GamepadState));
+	// Sample inputs just ahead of each USB frame instead of wherever the loop happens to be
+	ReportScheduler::getInstance().setEnabled(!configMode && Storage::getInstance().getGamepadOptions().frameSyncedReports);
+}
 
-		// Debounce
-		debounceGpioGetAll();
-		// Read Gamepad
-		gamepad->read();
+/**
+ * @brief Run a single pass of the Core0 input pipeline.
+ *
+ * Everything between reading the GPIO bank and handing the report to TinyUSB happens here, in order:
+ * debounce, gamepad read, add-on preprocess, hotkeys, gamepad process, add-on process, input driver
+ * report, tud_task, add-on postprocess and a flash commit step. Kept separate from run() so a single
+ * iteration can be driven on its own. Each stage is timed by PerfStats, on the device or under the
+ * trace-replay bench in bench/.
+ */
+void GP2040::process() {
+	Gamepad * gamepad = Storage::getInstance().GetGamepad();
+	Gamepad * processedGamepad = Storage::getInstance().GetProcessedGamepad();
+	GamepadState prevState;
+	PerfStats& perfStats = PerfStats::getInstance();
+
+	// Handle events Core1 queued for us
+	uint32_t stageStart = PerfStats::now();
+	EventManager::getInstance().processEvents();
+	perfStats.record(PERF_STAGE_CORE0_EVENTS, stageStart);
+
+	this->getReinitGamepad(gamepad);
+
+	memcpy(&prevState, &gamepad->state, sizeof(GamepadState));
+
+	// Wait for our slot in the USB frame, if frame-synced reports are on. The report for the frame that
+	// just started is already queued, so the time until the slot goes to any pending flash commit.
+	ReportScheduler& reportScheduler = ReportScheduler::getInstance();
+	bool framed = reportScheduler.waitForFrame();
+	if (framed) {
+		uint32_t flashStartUs = PerfStats::nowUs();
+		processFlashCommit(true, reportScheduler.getIdleUs());
+		perfStats.recordSinceUs(PERF_STAGE_FLASH_COMMIT, flashStartUs);
+	}
+	reportScheduler.waitForSlot();
+
+	// Debounce
+	uint32_t loopStartUs = PerfStats::nowUs();
+	uint32_t loopStart = PerfStats::now();
+	debounceGpioGetAll();
+	stageStart = perfStats.record(PERF_STAGE_DEBOUNCE, loopStart);
+	// Read Gamepad
+	gamepad->read();
+
+	checkRawState(prevState, gamepad->state);
+	if ((gamepad->state.dpad != prevState.dpad) || (gamepad->state.buttons != prevState.buttons) || (gamepad->state.aux != prevState.aux)) {
+		lastInputChange = get_absolute_time();
+	}
+	stageStart = perfStats.record(PERF_STAGE_READ, stageStart);
 
-		checkRawState(prevState, gamepad->state);
+	// Process USB Host on Core0
+	USBHostManager::getInstance().process();
+	perfStats.record(PERF_STAGE_TUH_TASK, stageStart);
 
-		// Process USB Host on Core0
-		USBHostManager::getInstance().process();
+	// Config Loop (Web-Config skips Core0 add-ons)
+	if (configMode == true) {
+		inputDriver->process(gamepad);
+		rebootHotkeys.process(gamepad, configMode);
+		// keep Core1 ticking, it waits on this
+		GamepadStateChannel::getInstance().publish(processedGamepad->state, processedGamepad->auxState);
+		processFlashCommit(true, flashProgramUs);
+		checkSaveRebootState();
+		return;
+	}
 
-		// Config Loop (Web-Config skips Core0 add-ons)
-		if (configMode == true) {
-			inputDriver->process(gamepad);
-			rebootHotkeys.process(gamepad, configMode);
-			checkSaveRebootState();
-			continue;
-		}
+	// Pre-Process add-ons for MPGS
+	addons.PreprocessAddons();
 
-		// Pre-Process add-ons for MPGS
-		addons.PreprocessAddons();
+	stageStart = PerfStats::now();
+	gamepad->hotkey(); 	// check for MPGS hotkeys
+	rebootHotkeys.process(gamepad, configMode);
 
-		gamepad->hotkey(); 	// check for MPGS hotkeys
-		rebootHotkeys.process(gamepad, configMode);
-		
-		gamepad->process(); // process through MPGS
+	gamepad->process(); // process through MPGS
+	perfStats.record(PERF_STAGE_GAMEPAD, stageStart);
 
-		// (Post) Process for add-ons
-		addons.ProcessAddons();
+	// (Post) Process for add-ons
+	addons.ProcessAddons();
 
-		checkProcessedState(processedGamepad->state, gamepad->state);
+	checkProcessedState(processedGamepad->state, gamepad->state);
 
-		// Copy Processed Gamepad for Core1 (race condition otherwise)
-		memcpy(&processedGamepad->state, &gamepad->state, sizeof(GamepadState));
+	// Copy Processed Gamepad for Core0 consumers
+	memcpy(&processedGamepad->state, &gamepad->state, sizeof(GamepadState));
 
-		// Process Input Driver
-		bool processed = inputDriver->process(gamepad);
-		
-		// TinyUSB Task update
-		tud_task();
+	// Process Input Driver
+	stageStart = PerfStats::now();
+	bool processed = inputDriver->process(gamepad);
+	ReportScheduler::getInstance().markReported(processed);
+	perfStats.record(PERF_STAGE_DRIVER, stageStart);
 
-		// Post-Process Add-ons with USB Report Processed Sent
-		addons.PostprocessAddons(processed);
+	// Hand the processed state and any aux state the driver just updated to Core1
+	GamepadStateChannel::getInstance().publish(processedGamepad->state, processedGamepad->auxState);
 
-		// Check if we have a pending save
-		checkSaveRebootState();
-	}
+	// TinyUSB Task update
+	stageStart = PerfStats::now();
+	tud_task();
+	perfStats.record(PERF_STAGE_TUD_TASK, stageStart);
+
+	// Post-Process Add-ons with USB Report Processed Sent
+	addons.PostprocessAddons(processed);
+
+	// Not frame-synced, so write a bit more of any pending save right after a report has gone out
+	uint32_t flashStartUs = PerfStats::nowUs();
+	processFlashCommit(!framed && processed, framed ? 0 : flashProgramUs);
+	perfStats.recordSinceUs(PERF_STAGE_FLASH_COMMIT, flashStartUs);
+
+	// Check if we have a pending save
+	checkSaveRebootState();
+	perfStats.recordSinceUs(PERF_STAGE_CORE0_LOOP, loopStartUs);
 }
 
 void GP2040::getReinitGamepad(Gamepad * gamepad) {
@@ -494,7 +651,7 @@ void GP2040::checkRawState(GamepadState prevState, GamepadState currState) {
         ((currState.dpad & ~prevState.dpad) != 0) ||
         ((currState.buttons & ~prevState.buttons) != 0)
     ) {
-        EventManager::getInstance().triggerEvent(new GPButtonDownEvent((currState.dpad & ~prevState.dpad), (currState.buttons & ~prevState.buttons), (currState.aux & ~prevState.aux)));
+        EventManager::getInstance().triggerEvent(GPButtonDownEvent((currState.dpad & ~prevState.dpad), (currState.buttons & ~prevState.buttons), (currState.aux & ~prevState.aux)));
     }
 
     // buttons released
@@ -503,7 +660,7 @@ void GP2040::checkRawState(GamepadState prevState, GamepadState currState) {
         ((prevState.dpad & ~currState.dpad) != 0) ||
         ((prevState.buttons & ~currState.buttons) != 0)
     ) {
-        EventManager::getInstance().triggerEvent(new GPButtonUpEvent((prevState.dpad & ~currState.dpad), (prevState.buttons & ~currState.buttons), (prevState.aux & ~currState.aux)));
+        EventManager::getInstance().triggerEvent(GPButtonUpEvent((prevState.dpad & ~currState.dpad), (prevState.buttons & ~currState.buttons), (prevState.aux & ~currState.aux)));
     }
 }
 
@@ -514,7 +671,7 @@ void GP2040::checkProcessedState(GamepadState prevState, GamepadState currState)
         ((currState.dpad & ~prevState.dpad) != 0) ||
         ((currState.buttons & ~prevState.buttons) != 0)
     ) {
-        EventManager::getInstance().triggerEvent(new GPButtonProcessedDownEvent((currState.dpad & ~prevState.dpad), (currState.buttons & ~prevState.buttons), (currState.aux & ~prevState.aux)));
+        EventManager::getInstance().triggerEvent(GPButtonProcessedDownEvent((currState.dpad & ~prevState.dpad), (currState.buttons & ~prevState.buttons), (currState.aux & ~prevState.aux)));
     }
 
     // buttons released
@@ -523,7 +680,7 @@ void GP2040::checkProcessedState(GamepadState prevState, GamepadState currState)
         ((prevState.dpad & ~currState.dpad) != 0) ||
         ((prevState.buttons & ~currState.buttons) != 0)
     ) {
-        EventManager::getInstance().triggerEvent(new GPButtonProcessedUpEvent((prevState.dpad & ~currState.dpad), (prevState.buttons & ~currState.buttons), (prevState.aux & ~currState.aux)));
+        EventManager::getInstance().triggerEvent(GPButtonProcessedUpEvent((prevState.dpad & ~currState.dpad), (prevState.buttons & ~currState.buttons), (prevState.aux & ~currState.aux)));
     }
 
     if (
@@ -534,7 +691,7 @@ void GP2040::checkProcessedState(GamepadState prevState, GamepadState currState)
         (currState.lt != prevState.lt) ||
         (currState.rt != prevState.rt)
     ) {
-        EventManager::getInstance().triggerEvent(new GPAnalogProcessedMoveEvent(currState.lx, currState.ly, currState.rx, currState.ry, currState.lt, currState.rt));
+        EventManager::getInstance().triggerEvent(GPAnalogProcessedMoveEvent(currState.lx, currState.ly, currState.rx, currState.ry, currState.lt, currState.rt));
     }
 }
 
@@ -554,6 +711,42 @@ void GP2040::checkSaveRebootState() {
 	}
 }
 
+/**
+ * @brief Run the next step of a pending flash commit, if now is a good time for it.
+ *
+ * inSlot is set right after the start of a frame when reports are frame-synced, with slotUs the time
+ * left before inputs have to be sampled, or right after a report went out when they aren't. A page
+ * program only runs when it fits in that slot. A sector erase can't fit anywhere, so it also waits for
+ * the inputs to go quiet, which makes the frames it costs ones with nothing new to report. Either
+ * gives up waiting eventually so a save always finishes.
+ */
+void GP2040::processFlashCommit(bool inSlot, uint32_t slotUs) {
+	if (!EEPROM.isBusy())
+		return;
+
+	absolute_time_t now = get_absolute_time();
+	if (is_nil_time(lastFlashStep))
+		lastFlashStep = now;
+	int64_t waitedUs = absolute_time_diff_us(lastFlashStep, now);
+
+	if (EEPROM.isErasing()) {
+		bool inputsIdle = absolute_time_diff_us(lastInputChange, now) >= (int64_t)flashEraseIdleMs * 1000;
+		if (!(inSlot && inputsIdle) && (waitedUs < (int64_t)flashEraseMaxWaitMs * 1000))
+			return;
+	} else {
+		uint32_t maxWaitUs = ReportScheduler::getInstance().isEnabled() ? flashStepSyncedIdleUs : flashStepIdleUs;
+		if (!(inSlot && slotUs >= flashProgramUs) && (waitedUs < maxWaitUs))
+			return;
+	}
+
+	EEPROM.step();
+	lastFlashStep = get_absolute_time();
+
+	EventManager::getInstance().triggerEvent(GPStorageCommitEvent(EEPROM.getStepsDone(), EEPROM.getStepsTotal()));
+	if (!EEPROM.isBusy())
+		lastFlashStep = nil_time;
+}
+
 void GP2040::handleStorageSave(GPEvent* e) {
     saveRequested = true;
 	forceSave = ((GPStorageSaveEvent*)e)->forceSave; 
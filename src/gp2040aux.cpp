@@ -3,9 +3,14 @@
 #include "gamepad.h"
 
 #include "drivermanager.h"
+#include "eventmanager.h"
+#include "gamepadstatechannel.h"
+#include "perfstats.h"
 #include "storagemanager.h"
 #include "usbhostmanager.h"
 
+#include "hardware/sync.h"
+
 #include "addons/board_led.h"  // Add-Ons
 #include "addons/buzzerspeaker.h"
 #include "addons/display.h"
@@ -16,7 +21,7 @@
 
 #include <iterator>
 
-GP2040Aux::GP2040Aux() : isReady(false), inputDriver(nullptr) {
+GP2040Aux::GP2040Aux() : isReady(false), inputDriver(nullptr), core1Gamepad(nullptr) {
 }
 
 GP2040Aux::~GP2040Aux() {
@@ -25,6 +30,9 @@ GP2040Aux::~GP2040Aux() {
 // GP2040Aux will always come after GP2040 setup(), so we can rely on the
 // GP2040 setup function for certain setup functions.
 void GP2040Aux::setup() {
+	// Core1 has its own SysTick for stage timing
+	PerfStats::getInstance().initCore();
+
 	// Initialize our input driver's auxilliary functions
 	inputDriver = DriverManager::getInstance().getDriver();
 	if ( inputDriver != nullptr ) {
@@ -46,19 +54,49 @@ void GP2040Aux::setup() {
 	addons.LoadAddon(new DRV8833RumbleAddon());
 	addons.LoadAddon(new ReactiveLEDAddon());
 
+	// Everything on Core1 reads from a snapshot Core0 publishes each loop. Add-on setup above is
+	// the only time Core1 writes aux state: it sets the enabled flags on the shared processed gamepad
+	// while Core0 waits on ready(), so Core0 publishes them from then on. After this the snapshot is
+	// read only, anything written to it would be overwritten by the next publish.
+	Gamepad * processedGamepad = Storage::getInstance().GetProcessedGamepad();
+	core1Gamepad = new Gamepad();
+	core1Gamepad->setup();
+	memcpy(&core1Gamepad->state, &processedGamepad->state, sizeof(GamepadState));
+	memcpy(&core1Gamepad->auxState, &processedGamepad->auxState, sizeof(GamepadAuxState));
+	Storage::getInstance().SetCore1Gamepad(core1Gamepad);
+
 	// Ready to sync Core0 and Core1
 	isReady = true;
 }
 
 void GP2040Aux::run() {
+	GamepadStateChannel& channel = GamepadStateChannel::getInstance();
+	PerfStats& perfStats = PerfStats::getInstance();
+	uint32_t lastSequence = 0;
+
 	while (1) {
+		// Nothing to do until Core0 finishes another pass, sleep until it signals
+		while (!channel.read(core1Gamepad->state, core1Gamepad->auxState, lastSequence)) {
+			__wfe();
+		}
+
+		// Handle events Core0 queued for us
+		uint32_t loopStartUs = PerfStats::nowUs();
+		uint32_t loopStart = PerfStats::now();
+		EventManager::getInstance().processEvents();
+		perfStats.record(PERF_STAGE_CORE1_EVENTS, loopStart);
+
 		// Pre, Process, and Post
 		addons.PreprocessAddons();
 		addons.ProcessAddons();
 
 		// Run auxiliary functions for input driver on Core1
 		if ( inputDriver != nullptr ) {
+			uint32_t stageStart = PerfStats::now();
 			inputDriver->processAux();
+			perfStats.record(PERF_STAGE_DRIVER_AUX, stageStart);
 		}
+		// Core0 can lock this core out for a whole flash erase anywhere in here
+		perfStats.recordSinceUs(PERF_STAGE_CORE1_LOOP, loopStartUs);
 	}
 }
@@ -0,0 +1,103 @@
+#include "gpioedgecapture.h"
+
+#include "hardware/gpio.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#include "hardware/timer.h"
+
+#define GPIO_EDGE_EVENTS (GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL)
+
+void GPIOEdgeCapture::start(Mask_t pinMask) {
+    stop();
+
+    head = 0;
+    tail = 0;
+    overflow = false;
+    pins = pinMask;
+    if (pins == 0)
+        return;
+
+    for (uint8_t pin = 0; pin < 32; pin++) {
+        if (pins & (1U << pin)) {
+            gpio_acknowledge_irq(pin, GPIO_EDGE_EVENTS);
+            gpio_set_irq_enabled(pin, GPIO_EDGE_EVENTS, true);
+        }
+    }
+    gpio_add_raw_irq_handler_masked(pins, &GPIOEdgeCapture::irqHandler);
+    irq_set_enabled(IO_IRQ_BANK0, true);
+}
+
+void GPIOEdgeCapture::stop() {
+    if (pins == 0)
+        return;
+
+    for (uint8_t pin = 0; pin < 32; pin++) {
+        if (pins & (1U << pin)) {
+            gpio_set_irq_enabled(pin, GPIO_EDGE_EVENTS, false);
+        }
+    }
+    gpio_remove_raw_irq_handler_masked(pins, &GPIOEdgeCapture::irqHandler);
+    pins = 0;
+}
+
+bool GPIOEdgeCapture::pop(GPIOEdgeEvent& event) {
+    uint32_t currentTail = tail;
+    if (currentTail == head)
+        return false;
+
+    __dmb(); // don't read the slot before we've seen the IRQ publish it
+    event = events[currentTail];
+    __dmb();
+    tail = (currentTail + 1) & (GPIO_EDGE_BUFFER_SIZE - 1);
+    return true;
+}
+
+bool GPIOEdgeCapture::takeOverflow() {
+    if (!overflow)
+        return false;
+
+    overflow = false;
+    return true;
+}
+
+void GPIOEdgeCapture::push(uint8_t pin, bool pressed, uint32_t timestamp) {
+    uint32_t currentHead = head;
+    uint32_t next = (currentHead + 1) & (GPIO_EDGE_BUFFER_SIZE - 1);
+    if (next == tail) {
+        overflow = true;
+        return;
+    }
+
+    events[currentHead].timestamp = timestamp;
+    events[currentHead].pin = pin;
+    events[currentHead].pressed = pressed;
+    __dmb(); // publish the slot before moving head
+    head = next;
+}
+
+void __not_in_flash_func(GPIOEdgeCapture::irqHandler)() {
+    GPIOEdgeCapture& capture = GPIOEdgeCapture::getInstance();
+    uint32_t now = time_us_32();
+
+    Mask_t pending = capture.pins;
+    while (pending) {
+        uint8_t pin = __builtin_ctz(pending);
+        pending &= pending - 1;
+
+        uint32_t events = gpio_get_irq_event_mask(pin) & GPIO_EDGE_EVENTS;
+        if (events == 0)
+            continue;
+        gpio_acknowledge_irq(pin, events);
+
+        // a single edge tells us the direction, if both latched we have to look at the pin
+        bool pressed;
+        if (events == GPIO_IRQ_EDGE_FALL)
+            pressed = true;
+        else if (events == GPIO_IRQ_EDGE_RISE)
+            pressed = false;
+        else
+            pressed = !gpio_get(pin);
+
+        capture.push(pin, pressed, now);
+    }
+}
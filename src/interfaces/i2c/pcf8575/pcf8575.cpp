@@ -12,6 +12,7 @@ void PCF8575::reset(){
 
 void PCF8575::send(uint16_t value) {
     dataSent = value;
+    dataOut = value;
     uc[0] = ((dataSent >> 0) & 0x00FF);
     uc[1] = ((dataSent >> 8) & 0x00FF);
     i2c->write(address, uc, 2);
@@ -24,19 +25,61 @@ uint16_t PCF8575::receive() {
     return dataReceived;
 }
 
+void PCF8575::update(bool startRead) {
+    if (readTransaction.status == I2C_TRANSACTION_DONE) {
+        dataReceived = ((readBuffer[0] << 0) | (readBuffer[1] << 8));
+    }
+
+    // Writing the port releases INT the same way a read does, so an input change that came in
+    // before the write would never get read. Read once after every write, whatever INT says.
+    if (readAfterWrite && !writeTransaction.isPending()) {
+        startRead = true;
+    }
+
+    if (startRead && !readTransaction.isPending()) {
+        if (!writeTransaction.isPending()) {
+            readAfterWrite = false;
+        }
+        readTransaction.address = address;
+        readTransaction.readData = readBuffer;
+        readTransaction.readLength = sizeof(readBuffer);
+        readTransaction.priority = 1;
+        i2c->submit(&readTransaction);
+    } else {
+        // keeps a running read or a commit() moving along
+        i2c->service();
+    }
+}
+
+void PCF8575::commit() {
+    // a failed write gets another go
+    if (writeTransaction.status == I2C_TRANSACTION_ERROR) {
+        writeTransaction.status = I2C_TRANSACTION_IDLE;
+        dataSent = ~dataOut;
+    }
+
+    if ((dataOut == dataSent) || writeTransaction.isPending()) return;
+
+    dataSent = dataOut;
+    writeBuffer[0] = ((dataSent >> 0) & 0x00FF);
+    writeBuffer[1] = ((dataSent >> 8) & 0x00FF);
+    writeTransaction.address = address;
+    writeTransaction.writeData = writeBuffer;
+    writeTransaction.writeLength = sizeof(writeBuffer);
+    i2c->submit(&writeTransaction);
+    readAfterWrite = true;
+}
+
 void PCF8575::setPin(uint8_t pinNumber, uint8_t value) {
     if (pinNumber < 16) {
         if (value == 0) {
-            dataSent &= ~(1 << pinNumber);
+            dataOut &= ~(1 << pinNumber);
         } else {
-            dataSent |= (1 << pinNumber);
+            dataOut |= (1 << pinNumber);
         }
-        send(dataSent);
     }
 }
 
 bool PCF8575::getPin(uint8_t pinNumber) {
-    uint16_t value = receive();
-
-    return (value & (1 << pinNumber)) > 0;
-}
\ No newline at end of file
+    return (dataReceived & (1 << pinNumber)) > 0;
+}
@@ -62,6 +62,7 @@ void GPGFX_TinySSD1306::init(GPGFX_DisplayTypeOptions options) {
 
     sendCommands(commands, sizeof(commands));
 
+    panelValid = false;
     clear();
     drawBuffer(NULL);
 }
@@ -435,42 +436,47 @@ void GPGFX_TinySSD1306::drawSprite(uint8_t* image, uint16_t width, uint16_t heig
 }
 
 void GPGFX_TinySSD1306::drawBuffer(uint8_t* pBuffer) {
-	uint16_t bufferSize = MAX_SCREEN_SIZE;
-	uint8_t buffer[bufferSize+1] = {SET_START_LINE};
-
-	int result = -1;
-	
-    if (this->screenType == ScreenAlternatives::SCREEN_132x64) {
-        uint16_t x = 0;
-        uint16_t y = 0;
-        for (y = 0; y < (MAX_SCREEN_HEIGHT/8); y++) {
-            sendCommand(0xB0 + y);
-            sendCommand(x & 0x0F);
-            sendCommand(0x10 | (x >> 4));
-        
-            if (pBuffer == NULL) {
-                memcpy(&buffer[1],&frameBuffer[y*MAX_SCREEN_WIDTH],MAX_SCREEN_WIDTH);
-            } else {
-                memcpy(&buffer[1],&pBuffer[y*MAX_SCREEN_WIDTH],MAX_SCREEN_WIDTH);
-            }
-        
-            result = _options.i2c->write(_options.address, buffer, MAX_SCREEN_WIDTH+3, false);
+    const uint8_t* source = (pBuffer == NULL) ? frameBuffer : pBuffer;
+    // SH1106 has 132 columns of RAM and the framebuffer only covers the first 128
+    uint8_t buffer[SH1106_RAM_WIDTH+1] = {SET_START_LINE};
+
+    // Most frames only change a few pages, and only part of those. Compare against what the panel
+    // was last sent and only write the changed column range of each changed page.
+    for (uint8_t page = 0; page < (MAX_SCREEN_HEIGHT/8); page++) {
+        const uint8_t* row = &source[page*MAX_SCREEN_WIDTH];
+        uint8_t* panelRow = &panelBuffer[page*MAX_SCREEN_WIDTH];
+
+        uint16_t start = 0;
+        uint16_t end = MAX_SCREEN_WIDTH;
+        if (panelValid) {
+            while ((start < end) && (row[start] == panelRow[start])) start++;
+            if (start == end) continue;
+            while (row[end-1] == panelRow[end-1]) end--;
         }
-    } else {
-        sendCommand(CommandOps::PAGE_ADDRESS);
-        sendCommand(0x00);
-        sendCommand(0x07);
-        sendCommand(CommandOps::COLUMN_ADDRESS);
-        sendCommand(0x00);
-        sendCommand(0x7F);
-
-        if (pBuffer == NULL) {
-            memcpy(&buffer[1],frameBuffer,bufferSize);
+
+        if (this->screenType == ScreenAlternatives::SCREEN_132x64) {
+            uint8_t commands[] = {0x00, (uint8_t)(0xB0 + page), (uint8_t)(start & 0x0F), (uint8_t)(SET_HIGH_COLUMN | (start >> 4))};
+            sendCommands(commands, sizeof(commands));
         } else {
-            memcpy(&buffer[1],pBuffer,bufferSize);
+            uint8_t commands[] = {0x00, CommandOps::PAGE_ADDRESS, page, page, CommandOps::COLUMN_ADDRESS, (uint8_t)start, (uint8_t)(end - 1)};
+            sendCommands(commands, sizeof(commands));
+        }
+
+        memcpy(&buffer[1], &row[start], end - start);
+        uint16_t length = end - start;
+        if (!panelValid && (this->screenType == ScreenAlternatives::SCREEN_132x64)) {
+            // blank the extra columns too, nothing else ever writes them
+            memset(&buffer[1 + length], 0, SH1106_RAM_WIDTH - MAX_SCREEN_WIDTH);
+            length = SH1106_RAM_WIDTH;
+        }
+        if (_options.i2c->write(_options.address, buffer, length + 1, false) < 0) {
+            // the panel may hold anything now, send everything next time
+            panelValid = false;
+            return;
         }
-        result = _options.i2c->write(_options.address, buffer, sizeof(buffer), false);
+        memcpy(&panelRow[start], &row[start], end - start);
     }
+    panelValid = true;
 
 	if (framePage < MAX_SCREEN_HEIGHT/8) {
 		framePage++;
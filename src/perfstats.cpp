@@ -0,0 +1,233 @@
+#include "perfstats.h"
+#include "system.h"
+
+#include "hardware/clocks.h"
+#include "pico/platform.h"
+
+#include <cstring>
+
+#define PERF_STATS_MAGIC 0x50455246 // "PERF"
+#define PERF_STATS_VERSION 4
+
+#define SYSTICK_MAX 0x00FFFFFF
+#define SYSTICK_ENABLE_PROCESSOR_CLOCK 0x5
+
+// Histogram resolution starts at 2^PERF_HISTOGRAM_MIN_BIT cycles
+#define PERF_HISTOGRAM_MIN_BIT 6
+
+struct PerfStatsData {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t clockHz;
+    uint32_t stageCount;
+    uint32_t missedFrames;
+    uint32_t droppedEvents[2]; // by the core that triggered them, so each has a single writer
+    uint32_t droppedHostReports;
+    PerfStageData stages[PERF_MAX_STAGES];
+};
+
+// Not cleared by the runtime, so it survives a watchdog reboot
+static PerfStatsData __uninitialized_ram(perfStatsData);
+
+static const char* const fixedStageNames[PERF_STAGE_FIXED_COUNT] = {
+    "Core0 Loop",
+    "Core0 Events",
+    "Debounce",
+    "Read",
+    "tuh_task",
+    "Gamepad",
+    "Driver",
+    "tud_task",
+    "Flash Commit",
+    "Report Age",
+    "Core1 Loop",
+    "Core1 Events",
+    "Driver Aux",
+};
+
+static inline uint32_t bucketFor(uint32_t cycles) {
+    if (cycles < (1u << PERF_HISTOGRAM_MIN_BIT))
+        return 0;
+    uint32_t msb = 31 - __builtin_clz(cycles);
+    uint32_t bucket = 1 + ((msb - PERF_HISTOGRAM_MIN_BIT) << 2) + ((cycles >> (msb - 2)) & 3);
+    return bucket < PERF_HISTOGRAM_BUCKETS ? bucket : PERF_HISTOGRAM_BUCKETS - 1;
+}
+
+// Exclusive upper end of a bucket in cycles
+static inline uint32_t bucketLimit(uint32_t bucket) {
+    if (bucket == 0)
+        return 1u << PERF_HISTOGRAM_MIN_BIT;
+    uint32_t msb = PERF_HISTOGRAM_MIN_BIT + ((bucket - 1) >> 2);
+    return (5 + ((bucket - 1) & 3)) << (msb - 2);
+}
+
+static inline uint32_t toNs(uint64_t cycles) {
+    return (cycles * 1000000000ull) / perfStatsData.clockHz;
+}
+
+static void initStage(PerfStageData& stage, const char* name, uint8_t core, uint8_t phase) {
+    memset(&stage, 0, sizeof(PerfStageData));
+    strncpy(stage.name, name, PERF_STAGE_NAME_LENGTH - 1);
+    stage.core = core;
+    stage.phase = phase;
+    stage.min = UINT32_MAX;
+}
+
+void PerfStats::startSysTick() {
+    systick_hw->csr = 0;
+    systick_hw->rvr = SYSTICK_MAX;
+    systick_hw->cvr = 0;
+    systick_hw->csr = SYSTICK_ENABLE_PROCESSOR_CLOCK;
+}
+
+void PerfStats::init() {
+    startSysTick();
+
+    bool previousValid = perfStatsData.magic == PERF_STATS_MAGIC &&
+        perfStatsData.version == PERF_STATS_VERSION &&
+        perfStatsData.stageCount >= PERF_STAGE_FIXED_COUNT &&
+        perfStatsData.stageCount <= PERF_MAX_STAGES &&
+        perfStatsData.clockHz != 0;
+    if (previousValid && System::peekBootMode() == System::BootMode::WEBCONFIG) {
+        recording = false;
+        return;
+    }
+
+    perfStatsData.magic = PERF_STATS_MAGIC;
+    perfStatsData.version = PERF_STATS_VERSION;
+    perfStatsData.clockHz = clock_get_hz(clk_sys);
+    perfStatsData.stageCount = PERF_STAGE_FIXED_COUNT;
+    perfStatsData.missedFrames = 0;
+    perfStatsData.droppedEvents[0] = 0;
+    perfStatsData.droppedEvents[1] = 0;
+    perfStatsData.droppedHostReports = 0;
+    for (uint32_t i = 0; i < PERF_STAGE_FIXED_COUNT; i++) {
+        initStage(perfStatsData.stages[i], fixedStageNames[i], i < PERF_STAGE_CORE1_LOOP ? 0 : 1, PERF_PHASE_NONE);
+    }
+    recording = true;
+}
+
+void PerfStats::initCore() {
+    startSysTick();
+}
+
+uint8_t PerfStats::addStage(const char* name, uint8_t phaseCount) {
+    if (!recording || perfStatsData.stageCount + phaseCount > PERF_MAX_STAGES)
+        return PERF_STAGE_NONE;
+
+    uint8_t first = perfStatsData.stageCount;
+    for (uint8_t i = 0; i < phaseCount; i++) {
+        initStage(perfStatsData.stages[first + i], name, get_core_num(), phaseCount > 1 ? PERF_PHASE_PREPROCESS + i : PERF_PHASE_NONE);
+    }
+    perfStatsData.stageCount += phaseCount;
+    return first;
+}
+
+uint32_t PerfStats::record(uint32_t stage, uint32_t start) {
+    uint32_t end = now();
+    if (!recording || stage >= perfStatsData.stageCount)
+        return end;
+
+    // SysTick counts down
+    addSample(stage, (start - end) & SYSTICK_MAX);
+    return end;
+}
+
+void PerfStats::recordUs(uint32_t stage, uint32_t us) {
+    if (!recording || stage >= perfStatsData.stageCount)
+        return;
+
+    addSample(stage, us * (perfStatsData.clockHz / 1000000));
+}
+
+void PerfStats::addSample(uint32_t stage, uint32_t cycles) {
+    PerfStageData& data = perfStatsData.stages[stage];
+    if (cycles < data.min)
+        data.min = cycles;
+    if (cycles > data.max)
+        data.max = cycles;
+    data.total += cycles;
+    data.count++;
+
+    // Halve everything when a bucket is about to overflow, the shape is what matters for p99
+    uint32_t bucket = bucketFor(cycles);
+    if (data.buckets[bucket] == UINT16_MAX) {
+        for (uint32_t i = 0; i < PERF_HISTOGRAM_BUCKETS; i++) {
+            data.buckets[i] >>= 1;
+        }
+    }
+    data.buckets[bucket]++;
+}
+
+void PerfStats::countMissedFrame() {
+    if (recording)
+        perfStatsData.missedFrames++;
+}
+
+uint32_t PerfStats::getMissedFrames() const {
+    return perfStatsData.missedFrames;
+}
+
+void PerfStats::countDroppedEvent() {
+    if (recording)
+        perfStatsData.droppedEvents[get_core_num()]++;
+}
+
+uint32_t PerfStats::getDroppedEvents() const {
+    return perfStatsData.droppedEvents[0] + perfStatsData.droppedEvents[1];
+}
+
+void PerfStats::countDroppedHostReport() {
+    if (recording)
+        perfStatsData.droppedHostReports++;
+}
+
+uint32_t PerfStats::getDroppedHostReports() const {
+    return perfStatsData.droppedHostReports;
+}
+
+uint32_t PerfStats::getStageCount() const {
+    return perfStatsData.stageCount;
+}
+
+bool PerfStats::getStage(uint32_t stage, PerfStageSummary& summary) {
+    if (stage >= perfStatsData.stageCount)
+        return false;
+
+    const PerfStageData& data = perfStatsData.stages[stage];
+    summary.name = data.name;
+    summary.core = data.core;
+    summary.phase = data.phase;
+    summary.count = data.count;
+    if (data.count == 0) {
+        summary.min = summary.avg = summary.max = summary.p99 = 0;
+        return true;
+    }
+
+    uint32_t histogramTotal = 0;
+    for (uint32_t i = 0; i < PERF_HISTOGRAM_BUCKETS; i++) {
+        histogramTotal += data.buckets[i];
+    }
+
+    // Walk down from the top until we've passed the slowest 1%. The last bucket has no upper end, max
+    // is the best there is for it.
+    uint32_t p99 = data.max;
+    uint32_t tail = histogramTotal / 100;
+    uint32_t seen = 0;
+    for (int32_t i = PERF_HISTOGRAM_BUCKETS - 1; i >= 0; i--) {
+        seen += data.buckets[i];
+        if (seen > tail) {
+            if (i < PERF_HISTOGRAM_BUCKETS - 1)
+                p99 = bucketLimit(i);
+            break;
+        }
+    }
+    if (p99 > data.max)
+        p99 = data.max;
+
+    summary.min = toNs(data.min);
+    summary.avg = toNs(data.total / data.count);
+    summary.max = toNs(data.max);
+    summary.p99 = toNs(p99);
+    return true;
+}
@@ -0,0 +1,117 @@
+#include "reportscheduler.h"
+#include "perfstats.h"
+
+#include "hardware/structs/usb.h"
+#include "hardware/timer.h"
+
+#include "tusb.h"
+
+#define FRAME_US 1000
+
+// Added on top of the measured pipeline time, covers jitter from IRQs and the other core
+#define REPORT_GUARD_US 100
+
+// Never sample more than this far ahead, at that point syncing isn't buying anything
+#define REPORT_MAX_LEAD_US 900
+
+// No frame for this long means the bus is suspended or gone, stop waiting on it
+#define FRAME_TIMEOUT_US 3000
+
+// The lead backs off by 1/2^n of the difference per frame when the pipeline gets faster again
+#define REPORT_LEAD_DECAY_SHIFT 6
+
+static inline uint32_t readFrameNumber() {
+    return usb_hw->sof_rd & USB_SOF_RD_BITS;
+}
+
+void ReportScheduler::setEnabled(bool enable) {
+    enabled = enable;
+    sampled = false;
+    framed = false;
+    frame = readFrameNumber();
+    frameSeenUs = time_us_32();
+    leadUs = REPORT_GUARD_US;
+}
+
+// Returns true if a new frame started since the last call
+bool ReportScheduler::pollFrame(uint32_t now) {
+    uint32_t current = readFrameNumber();
+    if (current == frame)
+        return false;
+
+    frame = current;
+    frameSeenUs = now;
+    return true;
+}
+
+bool ReportScheduler::waitForFrame() {
+    framed = false;
+    if (!enabled || !tud_ready())
+        return false;
+
+    uint32_t now = time_us_32();
+    pollFrame(now);
+    if ((now - frameSeenUs) > FRAME_TIMEOUT_US)
+        return false;
+
+    // Catch the start of the next frame so we know exactly where in it we are. If the last pass
+    // overran past it, markReported already counted that frame as missed.
+    while (!pollFrame(now)) {
+        now = time_us_32();
+        if ((now - frameSeenUs) > FRAME_TIMEOUT_US)
+            return false;
+    }
+
+    framed = true;
+    return true;
+}
+
+uint32_t ReportScheduler::getIdleUs() const {
+    if (!framed)
+        return 0;
+
+    uint32_t elapsed = time_us_32() - frameSeenUs;
+    uint32_t slot = FRAME_US - leadUs;
+    return (elapsed < slot) ? (slot - elapsed) : 0;
+}
+
+void ReportScheduler::waitForSlot() {
+    if (!framed)
+        return;
+    framed = false;
+
+    // Hold off until just enough time is left to build and queue the report
+    uint32_t sofUs = frameSeenUs;
+    while ((time_us_32() - sofUs) < (FRAME_US - leadUs))
+        tight_loop_contents();
+
+    sampleFrame = frame;
+    sampleSofUs = sofUs;
+    sampleUs = time_us_32();
+    sampled = true;
+}
+
+void ReportScheduler::markReported(bool sent) {
+    if (!enabled || !sampled)
+        return;
+    sampled = false;
+
+    uint32_t now = time_us_32();
+    if (sent) {
+        // Queued after the frame it was sampled for had started, so the host polled it a frame late
+        if (readFrameNumber() != sampleFrame)
+            PerfStats::getInstance().countMissedFrame();
+        else
+            PerfStats::getInstance().recordUs(PERF_STAGE_REPORT_AGE, (sampleSofUs + FRAME_US) - sampleUs);
+    }
+
+    uint32_t target = (now - sampleUs) + REPORT_GUARD_US;
+    if (target > REPORT_MAX_LEAD_US)
+        target = REPORT_MAX_LEAD_US;
+
+    // Jump straight up when the pipeline runs long, ease back down when it doesn't
+    if (target > leadUs)
+        leadUs = target;
+    else
+        leadUs -= (leadUs - target) >> REPORT_LEAD_DECAY_SHIFT;
+}
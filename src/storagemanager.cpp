@@ -12,7 +12,6 @@
 #include "eventmanager.h"
 #include "peripheralmanager.h"
 #include "config.pb.h"
-#include "hardware/watchdog.h"
 #include "CRC32.h"
 #include "types.h"
 
@@ -24,7 +23,14 @@
 void Storage::init() {
 	systemFlashSize = System::getPhysicalFlash(); // System Flash Size must be called once
 	EEPROM.start();
-	ConfigUtils::load(config);
+	saveAfterLoad = ConfigUtils::load(config);
+}
+
+bool Storage::takeSaveAfterLoad()
+{
+	bool pending = saveAfterLoad;
+	saveAfterLoad = false;
+	return pending;
 }
 
 /**
@@ -56,8 +62,9 @@ bool Storage::save(const bool force) {
 
 void Storage::ResetSettings()
 {
+	// The erase runs a sector per loop like any other commit, and the reboot finishes whatever's left
 	EEPROM.reset();
-	watchdog_reboot(0, SRAM_END, 2000);
+	EventManager::getInstance().triggerEvent(GPRestartEvent(System::BootMode::DEFAULT));
 }
 
 bool Storage::setProfile(const uint32_t profileNum)
@@ -67,7 +74,7 @@ bool Storage::setProfile(const uint32_t profileNum)
 		// is this profile enabled?
 		// profile 1 (core) is always enabled, others we must check
 		if (profileNum == 1 || config.profileOptions.gpioMappingsSets[profileNum-2].enabled) {
-			EventManager::getInstance().triggerEvent(new GPProfileChangeEvent(this->config.gamepadOptions.profileNumber, profileNum));
+			EventManager::getInstance().triggerEvent(GPProfileChangeEvent(this->config.gamepadOptions.profileNumber, profileNum));
 			this->config.gamepadOptions.profileNumber = profileNum;
 			return true;
 		}
@@ -151,5 +158,13 @@ void Storage::SetProcessedGamepad(Gamepad * newpad)
 
 Gamepad * Storage::GetProcessedGamepad()
 {
+	// Core1 reads its own copy so it never sees Core0 halfway through an update
+	if (core1Gamepad != nullptr && get_core_num() == 1)
+		return core1Gamepad;
 	return processedGamepad;
 }
+
+void Storage::SetCore1Gamepad(Gamepad * newpad)
+{
+	core1Gamepad = newpad;
+}
@@ -1,6 +1,7 @@
 #include "system.h"
 
 #include "usbhostmanager.h"
+#include "FlashPROM.h"
 
 #include <hardware/flash.h>
 #include <hardware/sync.h>
@@ -59,6 +60,9 @@ uint32_t System::getUsedHeap() {
 }
 
 void System::reboot(BootMode bootMode) {
+    // Finish writing any config that's still being committed
+    EEPROM.flush();
+
     // Halt all running USB instances
     USBHostManager::getInstance().shutdown();
 
@@ -75,7 +79,7 @@ void System::reboot(BootMode bootMode) {
 	}
 }
 
-System::BootMode System::takeBootMode() {
+System::BootMode System::peekBootMode() {
     // If the boot was not caused by software we don't enter any of the special modes
     if (!watchdog_caused_reboot()) {
         return BootMode::DEFAULT;
@@ -85,6 +89,14 @@ System::BootMode System::takeBootMode() {
     if (bootMode != BootMode::GAMEPAD && bootMode != BootMode::WEBCONFIG && bootMode != BootMode::USB) {
         bootMode = BootMode::DEFAULT;
     }
+    return bootMode;
+}
+
+System::BootMode System::takeBootMode() {
+    BootMode bootMode = peekBootMode();
+    if (!watchdog_caused_reboot()) {
+        return bootMode;
+    }
 
     // Reset the scratch register
     // Subsequent reboots should revert to BootMode::DEFAULT
@@ -2,6 +2,7 @@
 #include "storagemanager.h"
 #include "peripheralmanager.h"
 #include "eventmanager.h"
+#include "perfstats.h"
 
 #include "pio_usb.h"
 #include "tusb.h"
@@ -11,6 +12,8 @@
 
 #include "drivers/shared/xinput_host.h"
 
+#include <cstring>
+
 void USBHostManager::start() {
     // This will happen after Gamepad has initialized
     if (PeripheralManager::getInstance().isUSBEnabled(0) && listeners.size() > 0) {
@@ -35,10 +38,100 @@ void USBHostManager::pushListener(USBListener * usbListener) { // If anything ne
     listeners.push_back(usbListener);
 }
 
-// Host manager should call tuh_task as fast as possible
+// Host manager should call tuh_task as fast as possible. Reports that came in during
+// tuh_task() are handed to their listeners before returning, so they are folded into
+// the gamepad state by the add-ons later in this same loop.
 void USBHostManager::process() {
     if ( tuh_ready ){
         tuh_task();
+        deliverLatestReports();
+    }
+}
+
+USBHostRoute * USBHostManager::findRoute(uint8_t dev_addr, uint8_t instance, USBHostRouteClass routeClass) {
+    for (uint8_t i = 0; i < routeCount; i++) {
+        if (routes[i].dev_addr == dev_addr && routes[i].instance == instance && routes[i].routeClass == routeClass)
+            return &routes[i];
+    }
+    return nullptr;
+}
+
+// Ask every listener whether it wants this interface, once, instead of on every report
+void USBHostManager::addRoute(uint8_t dev_addr, uint8_t instance, USBHostRouteClass routeClass) {
+    uint32_t listenerMask = 0;
+    bool latestOnly = true;
+    for (uint8_t i = 0; i < listeners.size() && i < 32; i++) {
+        if (listeners[i]->wantsReports(dev_addr, instance)) {
+            listenerMask |= (1 << i);
+            latestOnly = latestOnly && listeners[i]->latestReportOnly(dev_addr, instance);
+        }
+    }
+
+    USBHostRoute * route = findRoute(dev_addr, instance, routeClass);
+    if (route == nullptr) {
+        if (listenerMask == 0 || routeCount == USB_HOST_ROUTE_COUNT)
+            return;
+        route = &routes[routeCount++];
+    }
+    route->dev_addr = dev_addr;
+    route->instance = instance;
+    route->routeClass = routeClass;
+    route->listenerMask = listenerMask;
+    route->latestOnly = latestOnly;
+    route->pending = false;
+}
+
+void USBHostManager::removeRoutes(uint8_t dev_addr, uint8_t instance, USBHostRouteClass routeClass, bool allInstances) {
+    for (uint8_t i = 0; i < routeCount;) {
+        if (routes[i].dev_addr == dev_addr && routes[i].routeClass == routeClass &&
+            (allInstances || routes[i].instance == instance)) {
+            routes[i] = routes[--routeCount];
+        } else {
+            i++;
+        }
+    }
+}
+
+void USBHostManager::deliverReport(USBHostRoute & route, uint8_t const* report, uint16_t len) {
+    uint32_t listenerMask = route.listenerMask;
+    for (uint8_t i = 0; listenerMask != 0; i++, listenerMask >>= 1) {
+        if (listenerMask & 1)
+            listeners[i]->report_received(route.dev_addr, route.instance, report, len);
+    }
+}
+
+void USBHostManager::routeReport(uint8_t dev_addr, uint8_t instance, USBHostRouteClass routeClass, uint8_t const* report, uint16_t len) {
+    USBHostRoute * route = findRoute(dev_addr, instance, routeClass);
+    if (route == nullptr) {
+        // With the table full, an interface a listener wanted may have been turned away at mount
+        if (routeCount == USB_HOST_ROUTE_COUNT) {
+            for (uint8_t i = 0; i < listeners.size() && i < 32; i++) {
+                if (listeners[i]->wantsReports(dev_addr, instance)) {
+                    PerfStats::getInstance().countDroppedHostReport();
+                    break;
+                }
+            }
+        }
+        return;
+    }
+
+    if (!route->latestOnly || len > USB_HOST_REPORT_MAX_LENGTH) {
+        deliverReport(*route, report, len);
+        return;
+    }
+
+    // Replaces any report still waiting, it's out of date now
+    memcpy(route->report, report, len);
+    route->len = len;
+    route->pending = true;
+}
+
+void USBHostManager::deliverLatestReports() {
+    for (uint8_t r = 0; r < routeCount; r++) {
+        if (routes[r].pending) {
+            routes[r].pending = false;
+            deliverReport(routes[r], routes[r].report, routes[r].len);
+        }
     }
 }
 
@@ -47,9 +140,11 @@ void USBHostManager::hid_mount_cb(uint8_t dev_addr, uint8_t instance, uint8_t co
     for( std::vector<USBListener*>::iterator it = listeners.begin(); it != listeners.end(); it++ ){
         (*it)->mount(dev_addr, instance, desc_report, desc_len);
     }
+    addRoute(dev_addr, instance, USB_HOST_ROUTE_HID);
 }
 
 void USBHostManager::hid_umount_cb(uint8_t dev_addr, uint8_t instance) {
+    removeRoutes(dev_addr, instance, USB_HOST_ROUTE_HID, false);
     if ( listeners.size() == 0 ) return;
     for( std::vector<USBListener*>::iterator it = listeners.begin(); it != listeners.end(); it++ ){
         (*it)->unmount(dev_addr);
@@ -57,10 +152,7 @@ void USBHostManager::hid_umount_cb(uint8_t dev_addr, uint8_t instance) {
 }
 
 void USBHostManager::hid_report_received_cb(uint8_t dev_addr, uint8_t instance, uint8_t const* report, uint16_t len) {
-    if ( listeners.size() == 0 ) return;
-    for( std::vector<USBListener*>::iterator it = listeners.begin(); it != listeners.end(); it++ ){
-        (*it)->report_received(dev_addr, instance, report, len);
-    }
+    routeReport(dev_addr, instance, USB_HOST_ROUTE_HID, report, len);
 }
 
 void USBHostManager::hid_set_report_complete_cb(uint8_t dev_addr, uint8_t instance, uint8_t report_id, uint8_t report_type, uint16_t len) {
@@ -82,9 +174,11 @@ void USBHostManager::xinput_mount_cb(uint8_t dev_addr, uint8_t instance, uint8_t
     for( std::vector<USBListener*>::iterator it = listeners.begin(); it != listeners.end(); it++ ){
         (*it)->xmount(dev_addr, instance, controllerType, subtype);
     }
+    addRoute(dev_addr, instance, USB_HOST_ROUTE_XINPUT);
 }
 
 void USBHostManager::xinput_umount_cb(uint8_t dev_addr) {
+    removeRoutes(dev_addr, 0, USB_HOST_ROUTE_XINPUT, true);
     if ( listeners.size() == 0 ) return;
     for( std::vector<USBListener*>::iterator it = listeners.begin(); it != listeners.end(); it++ ){
         (*it)->unmount(dev_addr);
@@ -92,10 +186,7 @@ void USBHostManager::xinput_umount_cb(uint8_t dev_addr) {
 }
 
 void USBHostManager::xinput_report_received_cb(uint8_t dev_addr, uint8_t instance, uint8_t const* report, uint16_t len) {
-    if ( listeners.size() == 0 ) return;
-    for( std::vector<USBListener*>::iterator it = listeners.begin(); it != listeners.end(); it++ ){
-        (*it)->report_received(dev_addr, instance, report, len);
-    }
+    routeReport(dev_addr, instance, USB_HOST_ROUTE_XINPUT, report, len);
 }
 
 void USBHostManager::xinput_report_sent_cb(uint8_t dev_addr, uint8_t instance, uint8_t const* report, uint16_t len) {
@@ -119,7 +210,7 @@ void tuh_mount_cb(uint8_t dev_addr) {
         vid = 0xFFFF;
         pid = 0xFFFF;
     }
-    EventManager::getInstance().triggerEvent(new GPUSBHostMountEvent(dev_addr, vid, pid));
+    EventManager::getInstance().triggerEvent(GPUSBHostMountEvent(dev_addr, vid, pid));
 }
 
 void tuh_umount_cb(uint8_t dev_addr) {
@@ -128,7 +219,7 @@ void tuh_umount_cb(uint8_t dev_addr) {
         vid = 0xFFFF;
         pid = 0xFFFF;
     }
-    EventManager::getInstance().triggerEvent(new GPUSBHostUnmountEvent(dev_addr, vid, pid));
+    EventManager::getInstance().triggerEvent(GPUSBHostUnmountEvent(dev_addr, vid, pid));
 }
 
 /// Invoked when device is unmounted (bus reset/unplugged)
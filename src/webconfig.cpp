@@ -8,14 +8,17 @@
 #include "peripheralmanager.h"
 #include "animationstorage.h"
 #include "system.h"
+#include "perfstats.h"
 #include "config_utils.h"
 #include "types.h"
 #include "version.h"
 
+#include <cstdlib>
 #include <cstring>
 #include <string>
 #include <vector>
 #include <memory>
+#include <new>
 #include <set>
 
 #include <pico/types.h>
@@ -35,14 +38,20 @@
 
 #define LWIP_HTTPD_POST_MAX_PAYLOAD_LEN (1024 * 16)
 
+// Room for the largest encoded Config and its CRC as well, for /api/config.pb
+#define CONFIG_PB_MAX_PAYLOAD_LEN (Config_size + 4)
+#define HTTP_POST_BUFFER_SIZE ((CONFIG_PB_MAX_PAYLOAD_LEN > LWIP_HTTPD_POST_MAX_PAYLOAD_LEN) ? CONFIG_PB_MAX_PAYLOAD_LEN : LWIP_HTTPD_POST_MAX_PAYLOAD_LEN)
+#define HTTP_POST_OVERFLOW UINT32_MAX // http_post_payload_len after the payload didn't fit
+
 extern struct fsdata_file file__index_html[];
 
 const static char* spaPaths[] = { "/backup", "/display-config", "/led-config", "/pin-mapping", "/settings", "/reset-settings", "/add-ons", "/custom-theme", "/macro", "/peripheral-mapping" };
 const static char* excludePaths[] = { "/css", "/images", "/js", "/static" };
 const static uint32_t rebootDelayMs = 500;
 static string http_post_uri;
-static char http_post_payload[LWIP_HTTPD_POST_MAX_PAYLOAD_LEN];
-static uint16_t http_post_payload_len = 0;
+static char http_post_payload[HTTP_POST_BUFFER_SIZE];
+static uint32_t http_post_payload_len = 0; // HTTP_POST_BUFFER_SIZE follows Config_size, which is already past 16 KB
+static bool http_post_pending = false; // the payload for http_post_uri hasn't been handled yet
 
 // Don't inline this function, we do not want to consume stack space in the calling function
 template <typename T, typename K>
@@ -226,22 +235,25 @@ struct DataAndStatusCode
     HttpStatusCode statusCode;
 };
 
+static const char* statusCodeString(HttpStatusCode statusCode)
+{
+    switch (statusCode)
+    {
+        case HttpStatusCode::_200: return "200 OK";
+        case HttpStatusCode::_400: return "400 Bad Request";
+        case HttpStatusCode::_500: return "500 Internal Server Error";
+    }
+    return "";
+}
+
 // **** WEB SERVER Overrides and Special Functionality ****
 int set_file_data(fs_file* file, const DataAndStatusCode& dataAndStatusCode)
 {
     static string returnData;
 
-    const char* statusCodeStr = "";
-    switch (dataAndStatusCode.statusCode)
-    {
-        case HttpStatusCode::_200: statusCodeStr = "200 OK"; break;
-        case HttpStatusCode::_400: statusCodeStr = "400 Bad Request"; break;
-        case HttpStatusCode::_500: statusCodeStr = "500 Internal Server Error"; break;
-    }
-
     returnData.clear();
     returnData.append("HTTP/1.0 ");
-    returnData.append(statusCodeStr);
+    returnData.append(statusCodeString(dataAndStatusCode.statusCode));
     returnData.append("\r\n");
     returnData.append(
         "Server: GP2040-CE " GP2040VERSION "\r\n"
@@ -269,6 +281,124 @@ int set_file_data(fs_file *file, string&& data)
     return set_file_data(file, DataAndStatusCode(std::move(data), HttpStatusCode::_200));
 }
 
+typedef bool (*StreamFuncPtr)(ConfigUtils::StreamWriter& writer, uint32_t arg, ConfigUtils::StreamPosition& position);
+
+// A response that is generated while httpd sends it. Opening it only works out Content-Length, then
+// every fs_read_custom() regenerates the part of the output the cursor is on and copies out the bytes
+// that haven't gone yet. Apart from httpd's send buffer only the header and the cursor are held.
+struct StreamedFile
+{
+    StreamFuncPtr generate = nullptr;
+    uint32_t arg = 0;
+    ConfigUtils::StreamPosition position;
+    size_t partOffset = 0; // bytes of the current part already sent
+    size_t headerLength = 0;
+    char header[192];
+};
+
+class CountingWriter : public ConfigUtils::StreamWriter
+{
+public:
+    virtual void write(const char* data, size_t length) { count += length; }
+    size_t count = 0;
+};
+
+// Drops the first skip bytes, then fills the buffer and stops the generator once it is full
+class WindowWriter : public ConfigUtils::StreamWriter
+{
+public:
+    WindowWriter(char* buffer, size_t size, size_t skip) : buffer(buffer), size(size), skip(skip) {}
+
+    virtual void write(const char* data, size_t length)
+    {
+        if (skip >= length)
+        {
+            skip -= length;
+            return;
+        }
+        data += skip;
+        length -= skip;
+        skip = 0;
+
+        size_t copy = std::min(length, size - written);
+        memcpy(buffer + written, data, copy);
+        written += copy;
+        finished = (copy < length);
+    }
+
+    size_t written = 0;
+private:
+    char* buffer;
+    size_t size;
+    size_t skip;
+};
+
+int set_file_stream(fs_file* file, StreamFuncPtr generate, uint32_t arg = 0, const char* contentType = "application/json")
+{
+    CountingWriter counter;
+    ConfigUtils::StreamPosition position;
+    while (generate(counter, arg, position));
+
+    StreamedFile* stream = new (std::nothrow) StreamedFile();
+    if (stream == nullptr)
+        return 0;
+
+    int headerLength = snprintf(stream->header, sizeof(stream->header),
+        "HTTP/1.0 %s\r\n"
+        "Server: GP2040-CE " GP2040VERSION "\r\n"
+        "Content-Type: %s\r\n"
+        "Access-Control-Allow-Origin: *\r\n"
+        "Content-Length: %d\r\n\r\n",
+        statusCodeString(HttpStatusCode::_200), contentType, static_cast<int>(counter.count));
+
+    stream->generate = generate;
+    stream->arg = arg;
+    stream->headerLength = headerLength;
+
+    file->data = NULL; // sends fs_read() to fs_read_custom()
+    file->len = headerLength + counter.count;
+    file->index = 0;
+    file->http_header_included = 1;
+    file->pextension = stream; // deleted in fs_close_custom
+
+    return 1;
+}
+
+int fs_read_custom(struct fs_file *file, char *buffer, int count)
+{
+    StreamedFile* stream = static_cast<StreamedFile*>(file->pextension);
+    const size_t length = static_cast<size_t>(std::min(count, file->len - file->index));
+    size_t filled = 0;
+
+    if (static_cast<size_t>(file->index) < stream->headerLength)
+    {
+        filled = std::min(length, stream->headerLength - file->index);
+        memcpy(buffer, stream->header + file->index, filled);
+    }
+
+    while (filled < length)
+    {
+        WindowWriter window(buffer + filled, length - filled, stream->partOffset);
+        const uint32_t part = stream->position.part;
+        if (!stream->generate(window, stream->arg, stream->position))
+        {
+            // The config was changed since Content-Length went out and the output came up short
+            memset(buffer + filled, ' ', length - filled);
+            filled = length;
+            break;
+        }
+
+        filled += window.written;
+        if (stream->position.part == part)
+            stream->partOffset += window.written;
+        else
+            stream->partOffset = 0;
+    }
+
+    file->index += length;
+    return static_cast<int>(length);
+}
+
 DynamicJsonDocument get_post_data()
 {
     DynamicJsonDocument doc(LWIP_HTTPD_POST_MAX_PAYLOAD_LEN);
@@ -337,7 +467,8 @@ err_t httpd_post_begin(void *connection, const char *uri, const char *http_reque
 
     http_post_uri = uri;
     http_post_payload_len = 0;
-    memset(http_post_payload, 0, LWIP_HTTPD_POST_MAX_PAYLOAD_LEN);
+    http_post_pending = false;
+    memset(http_post_payload, 0, HTTP_POST_BUFFER_SIZE);
     return ERR_OK;
 }
 
@@ -349,14 +480,14 @@ err_t httpd_post_receive_data(void *connection, struct pbuf *p)
     // Cache the received data to http_post_payload
     while (p != NULL)
     {
-        if (http_post_payload_len + p->len <= LWIP_HTTPD_POST_MAX_PAYLOAD_LEN)
+        if (http_post_payload_len != HTTP_POST_OVERFLOW && http_post_payload_len + p->len <= HTTP_POST_BUFFER_SIZE)
         {
             MEMCPY(http_post_payload + http_post_payload_len, p->payload, p->len);
             http_post_payload_len += p->len;
         }
         else // Buffer overflow
         {
-            http_post_payload_len = 0xffff;
+            http_post_payload_len = HTTP_POST_OVERFLOW;
             break;
         }
 
@@ -367,7 +498,7 @@ err_t httpd_post_receive_data(void *connection, struct pbuf *p)
     pbuf_free(p);
 
     // If the buffer overflows, error out
-    if (http_post_payload_len == 0xffff) {
+    if (http_post_payload_len == HTTP_POST_OVERFLOW) {
         return ERR_BUF;
     }
 
@@ -379,9 +510,10 @@ void httpd_post_finished(void *connection, char *response_uri, uint16_t response
 {
     LWIP_UNUSED_ARG(connection);
 
-    if (http_post_payload_len != 0xffff) {
+    if (http_post_payload_len != HTTP_POST_OVERFLOW) {
         strncpy(response_uri, http_post_uri.c_str(), response_uri_len);
         response_uri[response_uri_len - 1] = '\0';
+        http_post_pending = true;
     }
 }
 
@@ -459,7 +591,7 @@ std::string setDisplayOptions(DisplayOptions& displayOptions)
 std::string setDisplayOptions()
 {
     std::string response = setDisplayOptions(Storage::getInstance().getDisplayOptions());
-    EventManager::getInstance().triggerEvent(new GPStorageSaveEvent(true));
+    EventManager::getInstance().triggerEvent(GPStorageSaveEvent(true));
     return response;
 }
 
@@ -536,7 +668,7 @@ std::string setSplashImage()
     memcpy(displayOptions.splashImage.bytes, decoded.data(), length);
     displayOptions.splashImage.size = length;
 
-    EventManager::getInstance().triggerEvent(new GPStorageSaveEvent(true));
+    EventManager::getInstance().triggerEvent(GPStorageSaveEvent(true));
 
     return serialize_json(doc);
 }
@@ -581,7 +713,7 @@ std::string setProfileOptions()
         if (altsIndex > 4) break;
     }
 
-    EventManager::getInstance().triggerEvent(new GPStorageSaveEvent(true));
+    EventManager::getInstance().triggerEvent(GPStorageSaveEvent(true));
     return serialize_json(doc);
 }
 
@@ -659,6 +791,9 @@ std::string setGamepadOptions()
     readDoc(gamepadOptions.fourWayMode, doc, "fourWayMode");
     readDoc(gamepadOptions.profileNumber, doc, "profileNumber");
     readDoc(gamepadOptions.debounceDelay, doc, "debounceDelay");
+    readDoc(gamepadOptions.debounceMode, doc, "debounceMode");
+    readDoc(gamepadOptions.debounceEagerPins, doc, "debounceEagerPins");
+    readDoc(gamepadOptions.frameSyncedReports, doc, "frameSyncedReports");
     readDoc(gamepadOptions.inputModeB1, doc, "inputModeB1");
     readDoc(gamepadOptions.inputModeB2, doc, "inputModeB2");
     readDoc(gamepadOptions.inputModeB3, doc, "inputModeB3");
@@ -709,7 +844,7 @@ std::string setGamepadOptions()
     ForcedSetupOptions& forcedSetupOptions = Storage::getInstance().getForcedSetupOptions();
     readDoc(forcedSetupOptions.mode, doc, "forcedSetupMode");
 
-    EventManager::getInstance().triggerEvent(new GPStorageSaveEvent(true));
+    EventManager::getInstance().triggerEvent(GPStorageSaveEvent(true));
 
     return serialize_json(doc);
 }
@@ -728,6 +863,9 @@ std::string getGamepadOptions()
     writeDoc(doc, "fourWayMode", gamepadOptions.fourWayMode ? 1 : 0);
     writeDoc(doc, "profileNumber", gamepadOptions.profileNumber);
     writeDoc(doc, "debounceDelay", gamepadOptions.debounceDelay);
+    writeDoc(doc, "debounceMode", gamepadOptions.debounceMode);
+    writeDoc(doc, "debounceEagerPins", gamepadOptions.debounceEagerPins);
+    writeDoc(doc, "frameSyncedReports", gamepadOptions.frameSyncedReports ? 1 : 0);
     writeDoc(doc, "inputModeB1", gamepadOptions.inputModeB1);
     writeDoc(doc, "inputModeB2", gamepadOptions.inputModeB2);
     writeDoc(doc, "inputModeB3", gamepadOptions.inputModeB3);
@@ -837,7 +975,7 @@ std::string setLedOptions()
     readDoc(ledOptions.caseRGBIndex, doc, "caseRGBIndex");
     readDoc(ledOptions.caseRGBCount, doc, "caseRGBCount");
 
-    EventManager::getInstance().triggerEvent(new GPStorageSaveEvent(true));
+    EventManager::getInstance().triggerEvent(GPStorageSaveEvent(true));
     return serialize_json(doc);
 }
 
@@ -1051,7 +1189,7 @@ std::string setCustomTheme()
     readDoc(pressCooldown, doc, "buttonPressColorCooldownTimeInMs");
     options.buttonPressColorCooldownTimeInMs = pressCooldown;
 
-    EventManager::getInstance().triggerEvent(new GPStorageSaveEvent(true));
+    EventManager::getInstance().triggerEvent(GPStorageSaveEvent(true));
     return serialize_json(doc);
 }
 
@@ -1127,7 +1265,7 @@ std::string setPinMappings()
     gpioMappings.profileLabel[profileLabelSize - 1] = '\0';
     gpioMappings.enabled = doc["enabled"];
 
-    EventManager::getInstance().triggerEvent(new GPStorageSaveEvent(true));
+    EventManager::getInstance().triggerEvent(GPStorageSaveEvent(true));
 
     return serialize_json(doc);
 }
@@ -1222,7 +1360,7 @@ std::string setKeyMappings()
     readDoc(keyboardMapping.keyButtonE11, doc, "E11");
     readDoc(keyboardMapping.keyButtonE12, doc, "E12");
 
-    EventManager::getInstance().triggerEvent(new GPStorageSaveEvent(true));
+    EventManager::getInstance().triggerEvent(GPStorageSaveEvent(true));
 
     return serialize_json(doc);
 }
@@ -1385,7 +1523,7 @@ std::string setPeripheralOptions()
         profiles.gpioMappingsSets[2].pins[oldPinDplus+adjacent].action = GpioAction::NONE;
     }
 
-    EventManager::getInstance().triggerEvent(new GPStorageSaveEvent(true));
+    EventManager::getInstance().triggerEvent(GPStorageSaveEvent(true));
 
     return serialize_json(doc);
 }
@@ -1452,7 +1590,7 @@ std::string setExpansionPins()
     }
     Storage::getInstance().getAddonOptions().pcf8575Options.pins_count = 16;
 
-    EventManager::getInstance().triggerEvent(new GPStorageSaveEvent(true));
+    EventManager::getInstance().triggerEvent(GPStorageSaveEvent(true));
 
     return serialize_json(doc);
 }
@@ -1487,7 +1625,7 @@ std::string setReactiveLEDs()
     }
     Storage::getInstance().getAddonOptions().reactiveLEDOptions.leds_count = 10;
 
-    EventManager::getInstance().triggerEvent(new GPStorageSaveEvent(true));
+    EventManager::getInstance().triggerEvent(GPStorageSaveEvent(true));
 
     return serialize_json(doc);
 }
@@ -1666,6 +1804,7 @@ std::string setAddonOptions()
 
     PCF8575Options& pcf8575Options = Storage::getInstance().getAddonOptions().pcf8575Options;
     docToValue(pcf8575Options.enabled, doc, "PCF8575AddonEnabled");
+    docToPin(pcf8575Options.interruptPin, doc, "PCF8575InterruptPin");
 
     ReactiveLEDOptions& reactiveLEDOptions = Storage::getInstance().getAddonOptions().reactiveLEDOptions;
     docToValue(reactiveLEDOptions.enabled, doc, "ReactiveLEDAddonEnabled");
@@ -1679,7 +1818,7 @@ std::string setAddonOptions()
     docToValue(drv8833RumbleOptions.dutyMin, doc, "drv8833RumbleDutyMin");
     docToValue(drv8833RumbleOptions.dutyMax, doc, "drv8833RumbleDutyMax");
 
-    EventManager::getInstance().triggerEvent(new GPStorageSaveEvent(true));
+    EventManager::getInstance().triggerEvent(GPStorageSaveEvent(true));
 
     return serialize_json(doc);
 }
@@ -1752,7 +1891,7 @@ std::string setPS4Options()
     if (ps4Options.rsaQP.size != 0) ps4Options.rsaQP.size = 0;
     if (ps4Options.rsaRN.size != 0) ps4Options.rsaRN.size = 0;
 
-    EventManager::getInstance().triggerEvent(new GPStorageSaveEvent(true));
+    EventManager::getInstance().triggerEvent(GPStorageSaveEvent(true));
 
     return "{\"success\":true}";
 }
@@ -1835,7 +1974,7 @@ std::string setWiiControls()
     readDoc(wiiOptions.controllers.turntable.effects.axisType, doc, "turntable.analogEffects.axisType");
     readDoc(wiiOptions.controllers.turntable.fader.axisType, doc, "turntable.analogFader.axisType");
 
-    EventManager::getInstance().triggerEvent(new GPStorageSaveEvent(true));
+    EventManager::getInstance().triggerEvent(GPStorageSaveEvent(true));
 
     return "{\"success\":true}";
 }
@@ -2095,6 +2234,7 @@ std::string getAddonOptions()
 
     PCF8575Options& pcf8575Options = Storage::getInstance().getAddonOptions().pcf8575Options;
     writeDoc(doc, "PCF8575AddonEnabled", pcf8575Options.enabled);
+    writeDoc(doc, "PCF8575InterruptPin", cleanPin(pcf8575Options.interruptPin));
 
     ReactiveLEDOptions& reactiveLEDOptions = Storage::getInstance().getAddonOptions().reactiveLEDOptions;
     writeDoc(doc, "ReactiveLEDAddonEnabled", reactiveLEDOptions.enabled);
@@ -2150,7 +2290,7 @@ std::string setMacroAddonOptions()
 
     macroOptions.macroList_count = MAX_MACRO_LIMIT;
 
-    EventManager::getInstance().triggerEvent(new GPStorageSaveEvent(true));
+    EventManager::getInstance().triggerEvent(GPStorageSaveEvent(true));
     return serialize_json(doc);
 }
 
@@ -2214,6 +2354,40 @@ std::string getMemoryReport()
     return serialize_json(doc);
 }
 
+std::string getPerfStats()
+{
+    PerfStats& perfStats = PerfStats::getInstance();
+    const size_t capacity = JSON_OBJECT_SIZE(5) + JSON_ARRAY_SIZE(PERF_MAX_STAGES) + PERF_MAX_STAGES * JSON_OBJECT_SIZE(8);
+    DynamicJsonDocument doc(capacity);
+
+    // live is 0 when these are the numbers from the session before the reboot into web config
+    writeDoc(doc, "live", perfStats.isRecording() ? 1 : 0);
+    // frame-synced reports queued too late for the frame they were sampled for
+    writeDoc(doc, "missedFrames", perfStats.getMissedFrames());
+    // events one core triggered that the other core's queue had no room for
+    writeDoc(doc, "droppedEvents", perfStats.getDroppedEvents());
+    // USB host reports from an interface that didn't fit in the host manager's route table
+    writeDoc(doc, "droppedHostReports", perfStats.getDroppedHostReports());
+
+    JsonArray stageList = doc.createNestedArray("stages");
+    PerfStageSummary summary;
+    for (uint32_t i = 0; i < perfStats.getStageCount(); i++) {
+        if (!perfStats.getStage(i, summary) || summary.count == 0)
+            continue;
+        JsonObject stage = stageList.createNestedObject();
+        stage["name"] = summary.name;
+        stage["core"] = summary.core;
+        stage["phase"] = summary.phase;
+        stage["count"] = summary.count;
+        stage["minNs"] = summary.min;
+        stage["avgNs"] = summary.avg;
+        stage["maxNs"] = summary.max;
+        stage["p99Ns"] = summary.p99;
+    }
+
+    return serialize_json(doc);
+}
+
 static bool _abortGetHeldPins = false;
 
 std::string getHeldPins()
@@ -2297,6 +2471,58 @@ std::string getConfig()
     return ConfigUtils::toJSON(Storage::getInstance().getConfig());
 }
 
+bool streamConfig(ConfigUtils::StreamWriter& writer, uint32_t, ConfigUtils::StreamPosition& position)
+{
+    return ConfigUtils::toJSON(Storage::getInstance().getConfig(), position, writer);
+}
+
+// Raw nanopb encoded Config for backup and restore, a CRC32 trailer makes sure nothing got mangled on the way.
+// /api/config.pb covers the whole config, /api/config.pb/<field> just one top-level message, e.g. ledOptions.
+#define CONFIG_PB_PATH "/api/config.pb"
+
+bool streamConfigProtobuf(ConfigUtils::StreamWriter& writer, uint32_t section, ConfigUtils::StreamPosition& position)
+{
+    return ConfigUtils::toProtobuf(Storage::getInstance().getConfig(), section, position, writer);
+}
+
+// -1 if the path doesn't name the config or one of its sections
+static int32_t configProtobufSection(const char* name)
+{
+    const size_t pathLength = strlen(CONFIG_PB_PATH);
+    if (strncmp(name, CONFIG_PB_PATH, pathLength) != 0)
+        return -1;
+    if (name[pathLength] == '\0')
+        return 0;
+    if (name[pathLength] != '/')
+        return -1;
+    uint32_t section = ConfigUtils::findProtobufSection(name + pathLength + 1);
+    return (section != 0) ? section : -1;
+}
+
+DataAndStatusCode setConfigProtobuf(uint32_t section)
+{
+    // Store config struct on the heap to avoid stack overflow
+    std::unique_ptr<Config> config(new Config);
+    *config.get() = (section != 0) ? Storage::getInstance().getConfig() : Config Config_init_default;
+    if (ConfigUtils::fromProtobuf(*config.get(), Storage::getInstance().getConfig(), section, reinterpret_cast<const uint8_t*>(http_post_payload), http_post_payload_len))
+    {
+        Storage::getInstance().getConfig() = *config.get();
+        config.reset();
+        if (Storage::getInstance().save(true))
+        {
+            return DataAndStatusCode("{ \"success\": true }", HttpStatusCode::_200);
+        }
+        else
+        {
+            return DataAndStatusCode("{ \"error\": \"internal error while saving config\" }", HttpStatusCode::_500);
+        }
+    }
+    else
+    {
+        return DataAndStatusCode("{ \"error\": \"invalid or corrupted protobuf data\" }", HttpStatusCode::_400);
+    }
+}
+
 DataAndStatusCode setConfig()
 {
     // Store config struct on the heap to avoid stack overflow
@@ -2357,7 +2583,7 @@ std::string reboot() {
     } else if (bootMode == BOOT_MODES::BOOTSEL ) {
         systemBootMode = System::BootMode::USB;
     }
-    EventManager::getInstance().triggerEvent(new GPRestartEvent((System::BootMode)systemBootMode));
+    EventManager::getInstance().triggerEvent(GPRestartEvent((System::BootMode)systemBootMode));
     doc["success"] = true;
     return serialize_json(doc);
 }
@@ -2402,10 +2628,10 @@ static const std::pair<const char*, HandlerFuncPtr> handlerFuncs[] =
     { "/api/getSplashImage", getSplashImage },
     { "/api/getFirmwareVersion", getFirmwareVersion },
     { "/api/getMemoryReport", getMemoryReport },
+    { "/api/getPerfStats", getPerfStats },
     { "/api/getHeldPins", getHeldPins },
     { "/api/abortGetHeldPins", abortGetHeldPins },
     { "/api/getUsedPins", getUsedPins },
-    { "/api/getConfig", getConfig },
 #if !defined(NDEBUG)
     { "/api/echo", echo },
 #endif
@@ -2417,8 +2643,33 @@ static const std::pair<const char*, HandlerFuncStatusCodePtr> handlerFuncsWithSt
     { "/api/setConfig", setConfig },
 };
 
+static const std::pair<const char*, StreamFuncPtr> streamFuncs[] =
+{
+    { "/api/getConfig", streamConfig },
+};
+
 int fs_open_custom(struct fs_file *file, const char *name)
 {
+    for (const auto& streamFunc : streamFuncs)
+    {
+        if (strcmp(streamFunc.first, name) == 0)
+        {
+            return set_file_stream(file, streamFunc.second);
+        }
+    }
+
+    int32_t configSection = configProtobufSection(name);
+    if (configSection >= 0)
+    {
+        // The POST body has to be taken care of before the same path can be fetched again
+        if (http_post_pending && http_post_uri == name)
+        {
+            http_post_pending = false;
+            return set_file_data(file, setConfigProtobuf(configSection));
+        }
+        return set_file_stream(file, streamConfigProtobuf, configSection, "application/octet-stream");
+    }
+
     for (const auto& handlerFunc : handlerFuncs)
     {
         if (strcmp(handlerFunc.first, name) == 0)
@@ -2460,7 +2711,7 @@ void fs_close_custom(struct fs_file *file)
 {
     if (file && file->is_custom_file && file->pextension)
     {
-        mem_free(file->pextension);
+        delete static_cast<StreamedFile*>(file->pextension);
         file->pextension = NULL;
     }
 }
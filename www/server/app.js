@@ -115,6 +115,9 @@ app.get('/api/getGamepadOptions', (req, res) => {
 		fnButtonPin: -1,
 		profileNumber: 2,
 		debounceDelay: 5,
+		debounceMode: 0,
+		debounceEagerPins: 0,
+		frameSyncedReports: 0,
 		inputModeB1: 1,
 		inputModeB2: 0,
 		inputModeB3: 2,
@@ -809,6 +812,23 @@ app.get('/api/getMemoryReport', (req, res) => {
 	});
 });
 
+app.get('/api/getPerfStats', (req, res) => {
+	return res.send({
+		live: 0,
+		missedFrames: 3,
+		droppedEvents: 0,
+		droppedHostReports: 0,
+		stages: [
+			{ name: 'Core0 Loop', core: 0, phase: 0, count: 120000, minNs: 38000, avgNs: 41500, maxNs: 212000, p99Ns: 49152 },
+			{ name: 'Debounce', core: 0, phase: 0, count: 120000, minNs: 1200, avgNs: 1400, maxNs: 6100, p99Ns: 2048 },
+			{ name: 'Driver', core: 0, phase: 0, count: 120000, minNs: 4100, avgNs: 5200, maxNs: 19000, p99Ns: 8192 },
+			{ name: 'Report Age', core: 0, phase: 0, count: 119997, minNs: 52000, avgNs: 61000, maxNs: 240000, p99Ns: 81920 },
+			{ name: 'WiiExtension', core: 0, phase: 1, count: 120000, minNs: 18000, avgNs: 21000, maxNs: 180000, p99Ns: 28672 },
+			{ name: 'Display', core: 1, phase: 2, count: 118000, minNs: 900, avgNs: 2100, maxNs: 24000000, p99Ns: 1048576 },
+		],
+	});
+});
+
 app.get('/api/getHeldPins', async (req, res) => {
 	await new Promise((resolve) => setTimeout(resolve, 2000));
 	return res.send({
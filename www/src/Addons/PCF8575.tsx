@@ -11,6 +11,7 @@ import omit from 'lodash/omit';
 
 import Section from '../Components/Section';
 import CustomSelect from '../Components/CustomSelect';
+import FormControl from '../Components/FormControl';
 
 import { getButtonLabels } from '../Data/Buttons';
 import './PCF8575.scss';
@@ -33,10 +34,15 @@ export const pcf8575Scheme = {
 		.number()
 		.required()
 		.label('PCF8575 IO Add-On Enabled'),
+	PCF8575InterruptPin: yup
+		.number()
+		.label('PCF8575 Interrupt Pin')
+		.validatePinWhenValue('PCF8575AddonEnabled'),
 };
 
 export const pcf8575State = {
 	PCF8575AddonEnabled: 0,
+	PCF8575InterruptPin: -1,
 };
 
 const getOption = (foo, actionId) => {
@@ -216,6 +222,21 @@ const PCF8575 = ({ values, errors, handleChange, handleCheckbox }) => {
 				id="PCF8575AddonOptions"
 				hidden={!(values.PCF8575AddonEnabled && getAvailablePeripherals('i2c'))}
 			>
+				<Row className="mb-3">
+					<FormControl
+						type="number"
+						label={t('PCF8575:interrupt-pin-label')}
+						name="PCF8575InterruptPin"
+						className="form-control-sm"
+						groupClassName="col-sm-3 mb-3"
+						value={values.PCF8575InterruptPin}
+						error={errors.PCF8575InterruptPin}
+						isInvalid={errors.PCF8575InterruptPin}
+						onChange={handleChange}
+						min={-1}
+						max={29}
+					/>
+				</Row>
 				<Row className="mb-2">
 					<ExpansionPinsForm
 						pins={pins}
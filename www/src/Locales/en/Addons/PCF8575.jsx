@@ -1,6 +1,7 @@
 export default {
 	'header-text': 'PCF8575 IO Expander',
 	'block-label': 'I2C Block',
+	'interrupt-pin-label': 'Interrupt Pin',
 	'label-direction': {
 		input: 'Input',
 		output: 'Output',
@@ -57,6 +57,15 @@ export default {
 	},
 	'profile-label': 'Profile',
 	'debounce-delay-label': 'Debounce Delay in milliseconds',
+	'debounce-mode-label': 'Debounce Mode',
+	'debounce-mode-options': {
+		polled: 'Polled',
+		'edge-capture': 'Edge Capture',
+	},
+	'debounce-eager-pins-label': 'Eager Debounce Pins',
+	'debounce-eager-pins-help':
+		'These pins change state on their first edge, then ignore further edges for the debounce delay. Other pins wait until they have been stable for the debounce delay.',
+	'frame-synced-reports-label': 'Sample Inputs Just Before Each USB Frame',
 	'mini-menu-gamepad-input': 'Use Gamepad Input for Display Mini Menu',
 	'ps4-mode-explanation-text':
 		'PS4 mode allows GP2040-CE to run as an authenticated PS4 controller.',
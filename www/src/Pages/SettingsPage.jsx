@@ -225,6 +225,14 @@ const SOCD_MODES = [
 	{ labelKey: 'socd-cleaning-mode-options.off', value: 4 },
 ];
 
+const DEBOUNCE_MODES = [
+	{ labelKey: 'debounce-mode-options.polled', value: 0 },
+	{ labelKey: 'debounce-mode-options.edge-capture', value: 1 },
+];
+
+// RP2040 bank 0, same range as the pin mapping page
+const GPIO_PIN_COUNT = 30;
+
 const PS4_MODES = [
 	{ labelKey: 'ps4-mode-options.controller', value: 0 },
 	{ labelKey: 'ps4-mode-options.arcadestick', value: 7 },
@@ -409,6 +417,19 @@ const schema = yup.object().shape({
 		.oneOf(AUTHENTICATION_TYPES.map((o) => o.value))
 		.label('X-Input Authentication Type'),
 	debounceDelay: yup.number().required().label('Debounce Delay'),
+	debounceMode: yup
+		.number()
+		.required()
+		.oneOf(DEBOUNCE_MODES.map((o) => o.value))
+		.label('Debounce Mode'),
+	debounceEagerPins: yup
+		.number()
+		.required()
+		.integer()
+		.min(0)
+		.max(2 ** GPIO_PIN_COUNT - 1)
+		.label('Eager Debounce Pins'),
+	frameSyncedReports: yup.number().required().label('Frame-Synced Reports'),
 	miniMenuGamepadInput: yup.number().required().label('Mini Menu'),
 	inputModeB1: yup
 		.number()
@@ -478,6 +499,8 @@ const FormContext = ({ setButtonLabels, setKeyMappings }) => {
 		if (!!values.dpadMode) values.dpadMode = parseInt(values.dpadMode);
 		if (!!values.inputMode) values.inputMode = parseInt(values.inputMode);
 		if (!!values.socdMode) values.socdMode = parseInt(values.socdMode);
+		if (!!values.debounceMode)
+			values.debounceMode = parseInt(values.debounceMode);
 		if (!!values.switchTpShareForDs4)
 			values.switchTpShareForDs4 = parseInt(values.switchTpShareForDs4);
 		if (!!values.forcedSetupMode)
@@ -1363,6 +1386,7 @@ export default function SettingsPage() {
 	const translatedInputModeGroups = translateArray(INPUT_MODE_GROUPS);
 	const translatedDpadModes = translateArray(DPAD_MODES);
 	const translatedSocdModes = translateArray(SOCD_MODES);
+	const translatedDebounceModes = translateArray(DEBOUNCE_MODES);
 	const translatedHotkeyActions = translateArray(HOTKEY_ACTIONS);
 	const translatedForcedSetupModes = translateArray(FORCED_SETUP_MODES);
 	// Not currently used but we might add the option at a later date (wheel type, etc.)
@@ -1615,6 +1639,88 @@ export default function SettingsPage() {
 															/>
 														</Col>
 													</Form.Group>
+													<Form.Group className="row mb-3">
+														<Form.Label>
+															{t('SettingsPage:debounce-mode-label')}
+														</Form.Label>
+														<Col sm={3}>
+															<Form.Select
+																name="debounceMode"
+																className="form-select-sm"
+																value={values.debounceMode}
+																onChange={handleChange}
+																isInvalid={errors.debounceMode}
+															>
+																{translatedDebounceModes.map((o, i) => (
+																	<option
+																		key={`button-debounceMode-option-${i}`}
+																		value={o.value}
+																	>
+																		{o.label}
+																	</option>
+																))}
+															</Form.Select>
+															<Form.Control.Feedback type="invalid">
+																{errors.debounceMode}
+															</Form.Control.Feedback>
+														</Col>
+													</Form.Group>
+													{values.debounceMode === 1 && (
+														<Form.Group className="row mb-3">
+															<Form.Label>
+																{t('SettingsPage:debounce-eager-pins-label')}
+															</Form.Label>
+															<Col sm={9}>
+																<div className="d-flex flex-wrap column-gap-3">
+																	{[...Array(GPIO_PIN_COUNT).keys()].map((pin) => (
+																		<Form.Check
+																			key={`debounceEagerPins-${pin}`}
+																			id={`debounceEagerPins-${pin}`}
+																			label={`GP${pin}`}
+																			type="checkbox"
+																			isInvalid={!!errors.debounceEagerPins}
+																			checked={Boolean(
+																				(values.debounceEagerPins >>> pin) & 1,
+																			)}
+																			onChange={(e) => {
+																				const bit = 2 ** pin;
+																				const current = values.debounceEagerPins || 0;
+																				setFieldValue(
+																					'debounceEagerPins',
+																					e.target.checked
+																						? (current | bit) >>> 0
+																						: (current & ~bit) >>> 0,
+																				);
+																			}}
+																		/>
+																	))}
+																</div>
+																<Form.Text className="text-muted">
+																	{t('SettingsPage:debounce-eager-pins-help')}
+																</Form.Text>
+																<Form.Control.Feedback type="invalid">
+																	{errors.debounceEagerPins}
+																</Form.Control.Feedback>
+															</Col>
+														</Form.Group>
+													)}
+													<Form.Group className="row mb-3">
+														<Col sm={5}>
+															<Form.Check
+																label={t('SettingsPage:frame-synced-reports-label')}
+																type="switch"
+																id="frameSyncedReports"
+																isInvalid={false}
+																checked={Boolean(values.frameSyncedReports)}
+																onChange={(e) => {
+																	setFieldValue(
+																		'frameSyncedReports',
+																		e.target.checked ? 1 : 0,
+																	);
+																}}
+															/>
+														</Col>
+													</Form.Group>
 													<Form.Group className="row mb-5">
 														<Col sm={5}>
 															<Form.Check